@@ -5,12 +5,19 @@
     #include "src/Geometry.h"
     #include "src/Region.h"
     #include "src/Surface.h"
+    #include "src/Lattice.h"
+    #include "src/PinCell.h"
+    #include "src/CompiledGeometry.h"
+    #include "src/TrackRecorder.h"
+    #include "src/Multipole.h"
+    #include "src/CompactXS.h"
     #include "src/Isotope.h"
     #include "src/Material.h"
     #include "src/Tally.h"
     #include "src/TallyBank.h"
     #include "src/TallyFactory.h"
     #include "src/Neutron.h"
+    #include "src/Source.h"
     #include "src/Fissioner.h"
     #include "src/log.h"
     #include "src/vector.h"
@@ -57,6 +64,11 @@
 
 %ignore Tally::operator=(Tally* tally);
 %ignore Tally::operator=(const Tally& tally);
+%ignore Isotope::evaluateXS(xsType type, float* energies, float* xs, int num_energies, float temperature) const;
+%ignore Material::evaluateMacroXS(xsType type, float* energies, float* xs, int num_energies, float temperature);
+%ignore regionNeighbor;
+%ignore computePlaneDistance;
+%ignore computeCylinderDistance;
 
 
 %apply (float* ARGOUT_ARRAY1, int DIM1) {(float* xs, int num_xs)}
@@ -72,6 +84,12 @@
 %apply (double* IN_ARRAY1, int DIM1) {(double* energies, int num_energies), (double* elastic_xs, int num_xs)}
 %apply (double* IN_ARRAY1, int DIM1) {(double* energies, int num_energies), (double* capture_xs, int num_xs)}
 %apply (double* IN_ARRAY1, int DIM1) {(double* energies, int num_energies), (double* fission_xs, int num_xs)}
+%apply (double* IN_ARRAY1, int DIM1) {(double* energies, int num_energies), (double* xs_values, int num_xs)}
+%apply (double* IN_ARRAY1, int DIM1) {(double* energies, int num_energies), (double* spectrum, int num_values)}
+%apply (float* ARGOUT_ARRAY1, int DIM1) {(float* samples, int num_samples)}
+%apply (int* ARGOUT_ARRAY1, int DIM1) {(int* uids, int num_pixels)}
+%apply (float* ARGOUT_ARRAY1, int DIM1) {(float* data, int num_points)}
+%apply (int* ARGOUT_ARRAY1, int DIM1) {(int* data, int num_points)}
 
 
 %apply (int* IN_ARRAY1, int DIM1) {(const int* amt, const int length)}
@@ -82,12 +100,19 @@
 %include src/Geometry.h
 %include src/Region.h
 %include src/Surface.h
+%include src/Lattice.h
+%include src/PinCell.h
+%include src/CompiledGeometry.h
+%include src/TrackRecorder.h
+%include src/Multipole.h
+%include src/CompactXS.h
 %include src/Isotope.h
 %include src/Material.h
 %include src/Tally.h
 %include src/TallyBank.h
 %include src/TallyFactory.h
 %include src/Neutron.h
+%include src/Source.h
 %include src/Fissioner.h
 %include src/log.h
 %include src/vector.h
@@ -22,9 +22,6 @@ pkg_path = os.path.dirname(__file__)
 xs_lib_path = os.path.join(pkg_path, 'xs-lib/')
 setXSLibDirectory(xs_lib_path)
 
-# Restore the cross-section library from backup
-restoreXSLibrary()
-
 # Get instances of TallyBank and TallyFactory singleton classes
 TallyBank = pinspec.TallyBank.Get()
 TallyFactory = pinspec.TallyFactory.Get()
@@ -389,11 +389,10 @@ def plotFissionSpectrum():
     filename = directory + '/' + 'fission-spectrum-cdf.png'
     plt.savefig(filename)
 
-    # Sample from fission CDF to get fission spectrum
+    # Sample the Watt spectrum to get fission spectrum
     num_samples = 10000000
-    emitted_energies = np.zeros(num_samples)
-    for i in range(num_samples):
-        emitted_energies[i] = fissioner.emitNeutronMeV()
+    source = pinspec.Source()
+    emitted_energies = source.sampleEnergies(num_samples) / 1E6
 
     # Bin the samples    
     binned_samples, bin_edges = np.histogram(emitted_energies, bins=1000, 
@@ -580,7 +579,14 @@ def plotSlice(space, plane='XY', loc=0.0, lim1=[-2., 2.], lim2=[-2., 2.],
     dim1 = np.linspace(lim1[0], lim1[1], gridsize)
     dim2 = np.linspace(lim2[0], lim2[1], gridsize)
 
-    if plane.lower() == 'xy':
+    # We are plotting the geometry, whose regions are found in C++
+    if isinstance(space, Geometry):
+        surface = space.rasterizeSlice(gridsize * gridsize, plane.upper(), 
+                                       loc, lim1[0], lim1[1], lim2[0], 
+                                       lim2[1], gridsize)
+        surface = surface.reshape((gridsize, gridsize))
+
+    elif plane.lower() == 'xy':
 
         # We are plotting a region
         if isinstance(space, (BoundedRegion, BoundedModeratorRegion, \
@@ -592,19 +598,7 @@ def plotSlice(space, plane='XY', loc=0.0, lim1=[-2., 2.], lim2=[-2., 2.],
                     if space.contains(dim1[i], dim2[j], loc):
                         surface[j][i] = 1.0
 
-        # We are plotting the geometry
-        else:
-
-            for i in range(len(dim1)):
-                for j in range(len(dim2)):
-            
-                    # Color space for points within the space
-                    if space.contains(dim1[i], dim2[j], loc):
-                        region = space.findContainingRegion(dim1[i], \
-                                                            dim2[j], loc)
-                        surface[j][i] = region.getUid()
-
-    if plane.lower() == 'xz':
+    elif plane.lower() == 'xz':
 
         # We are plotting a region
         if isinstance(space, (BoundedRegion, BoundedModeratorRegion, \
@@ -616,20 +610,7 @@ def plotSlice(space, plane='XY', loc=0.0, lim1=[-2., 2.], lim2=[-2., 2.],
                     if space.contains(dim1[i], loc, dim2[j]):
                         surface[j][i] = 1.0
 
-        # We are plotting the geometry
-        else:
-
-            for i in range(len(dim1)):
-                for j in range(len(dim2)):
-            
-                    # Color space for points within the space
-                    if space.contains(dim1[i], loc, dim2[j]):
-                        region = space.findContainingRegion(dim1[i], loc,
-                                                            dim2[j])
-                        surface[j][i] = region.getUid()
-
-
-    if plane.lower() == 'yz':
+    elif plane.lower() == 'yz':
 
         # We are plotting a region
         if isinstance(space, (BoundedRegion, BoundedModeratorRegion, \
@@ -643,18 +624,6 @@ def plotSlice(space, plane='XY', loc=0.0, lim1=[-2., 2.], lim2=[-2., 2.],
                     if space.contains(loc, dim1[i], dim2[j]):
                         surface[j][i] = 1.0
 
-        # We are plotting the geometry
-        else:
-
-            for i in range(len(dim1)):
-                for j in range(len(dim2)):
-            
-                    # Color space for points within the space
-                    if space.contains(loc, dim1[i], dim2[j]):
-                        region = space.findContainingRegion(loc, dim1[i],
-                                                            dim2[j])
-                        surface[j][i] = region.getUid()
-
     
     fig = plt.figure()
     plt.pcolor(dim1, dim2, surface)
@@ -824,75 +793,28 @@ def trackANeutron(geometry, plane='XY', num_moves=100, loc=0.0, \
     # First plot the regions in the geometry as a backdrop for the
     # neutron's path
 
-    # Initialize a numpy array for the surface colors
-    surface = numpy.zeros((gridsize, gridsize), dtype=np.int32)
+    # Find the regions in the geometry in C++
+    surface = geometry.rasterizeSlice(gridsize * gridsize, plane.upper(), 
+                                      loc, lim1[0], lim1[1], lim2[0], 
+                                      lim2[1], gridsize)
+    surface = surface.reshape((gridsize, gridsize))
 
-    # Initialize 
     dim1 = np.linspace(lim1[0], lim1[1], gridsize)
     dim2 = np.linspace(lim2[0], lim2[1], gridsize)
 
-    if plane.lower() == 'xy':
-
-        for i in range(len(dim1)):
-            for j in range(len(dim2)):
-            
-                # Color space for points within the space
-                if geometry.contains(dim1[i], dim2[j], loc):
-                    region = geometry.findContainingRegion(dim1[i], \
-                                                        dim2[j], loc)
-                    surface[j][i] = region.getUid()
-
-    if plane.lower() == 'xz':
-
-        for i in range(len(dim1)):
-            for j in range(len(dim2)):
-            
-                # Color space for points within the space
-                if geometry.contains(dim1[i], loc, dim2[j]):
-                    region = geometry.findContainingRegion(dim1[i], loc,
-                                                        dim2[j])
-                    surface[j][i] = region.getUid()
-
-
-    if plane.lower() == 'yz':
-
-        for i in range(len(dim1)):
-            for j in range(len(dim2)):
-         
-                # Color space for points within the space
-                if geometry.contains(loc, dim1[i], dim2[j]):
-                    region = geometry.findContainingRegion(loc, dim1[i],
-                                                        dim2[j])
-                    surface[j][i] = region.getUid()
-
     
     # Plot the regions in the geometry
     fig = plt.figure()
     plt.pcolor(dim1, dim2, surface)
     plt.axis([lim1[0], lim1[1], lim2[0], lim2[1]])
 
-    # Create a neutron to track
-    neutron = createNewNeutron()
-    geometry.initializeSourceNeutron(neutron)
-
-    # Initialize empty lists to track the neutron's location
-    x = []
-    y = []
-    z = []
-
-    # Track the neutron
-    for i in range(num_moves):
-
-        # If the neutron was killed on the last collision, then break loop
-        if not neutron._alive:
-            break
-
-        geometry.findContainingRegion(neutron)
-        region = neutron._region
-        region.collideNeutron(neutron)
-        x.append(neutron._x)
-        y.append(neutron._y)
-        z.append(neutron._z)
+    # Record the neutron's track in C++ for up to num_moves moves
+    recorder = TrackRecorder(num_moves + 1)
+    geometry.recordTracks(recorder, 1)
+    num_points = recorder.getNumPoints()
+    x = recorder.retrieveX(num_points)
+    y = recorder.retrieveY(num_points)
+    z = recorder.retrieveZ(num_points)
 
     # Plot the neutron path throughout the geometry
     if plane.lower() == 'xy':
@@ -738,18 +738,14 @@ class RITrue(object):
         ## The number of resonance integrals
         self._num_RIs = len(self._energy_bands)-1
 
-        # Retrieve xs and energies directly from isotope
-        num_energies = self._isotope.getNumXSEnergies(reaction)
-        energies = self._isotope.retrieveXSEnergies(num_energies, reaction)
-        xs = self._isotope.retrieveXS(num_energies, reaction)
-                
-        # Interpolate into the xs
+        # Evaluate the xs directly from the isotope
         self._RIs = np.zeros(self._energy_bands.size-1)
 
         for i in range(self._num_RIs):
             interp_energies = np.logspace(np.log10(self._energy_bands[i]), \
                                     np.log10(self._energy_bands[i+1]), 10000)
-            interp_xs = np.interp(interp_energies, energies, xs)
+            interp_xs = self._isotope.evaluateXS(interp_energies, \
+                                            interp_energies.size, reaction)
             self._RIs[i] = integrate.trapz(interp_xs * (1./interp_energies), \
                                                             interp_energies)
 
@@ -19,6 +19,10 @@ import subprocess
 import math
 import scipy.special as spec
 
+# The temperatures at which the SLBW cross-sections registered as overrides
+# with the cross-section library were generated
+_slbw_temperatures = {}
+
 ##
 # @brief Function to create resonant capture and scatter cross-sections.
 # @details Generates the cross-section at some temperature using resonance
@@ -187,48 +191,21 @@ def buildSLBWXS(isotope,temp,xs_type='capture',number_of_pos_res=14, \
     sigma_g = numpy.append(sigma_g, sigma_g2)
     sigma_n = numpy.append(sigma_n, sigma_n2)
     E = numpy.append(E, E2)
-    EAXS = (E, sigma_g)
-    EAXS = numpy.transpose(EAXS)
-    ESXS = (E, sigma_n)
-    ESXS = numpy.transpose(ESXS)
 
     #----------------------------------
     #---So if capture is specified
     #---------------------------------
     if xs_type=='capture':
-   	# write output file for capture XS
-	out_name = pinspec.getXSLibDirectory()+El+'-'+str(int(A))+'-capture.txt'
-	numpy.savetxt(out_name, EAXS, newline='\n', delimiter=',')
-	# go back and add header
-	f = open(out_name)
-	text = f.read()
-	f.close()
-	# open the file again for writing
-	f = open(out_name, 'w')
-	f.write('Doppler Broadened SLBW fictitious capture XS at temp=' + \
-			str(temp)+'K\n')
-	# write the original contents
-	f.write(text)
-	f.close()
+	# register an in-memory override for the capture XS
+	pinspec.setXSOverride(El+'-'+str(int(A)), 'capture', E, sigma_g)
+	_slbw_temperatures[(El+'-'+str(int(A)), 'capture')] = temp
     #----------------------------------
-    #---So if capture is specified
+    #---So if scatter is specified
     #---------------------------------
     if xs_type=='scatter':
-   	# write output file for scatter XS
-	out_names = pinspec.getXSLibDirectory()+El+'-'+str(int(A))+'-elastic.txt'
-	numpy.savetxt(out_names, ESXS, newline='\n', delimiter=',')
-	# go back and add header
-	g = open(out_names)
-	texts = g.read()
-	g.close()
-	# open the file again for writing
-	g = open(out_names, 'w')
-	g.write('Doppler Broadened SLBW fictitious resonant scattering XS ' + \
-			'at temp='+str(temp)+'K\n')
-	# write the original contents
-	g.write(texts)
-	g.close()
-	#-----------------
+	# register an in-memory override for the scatter XS
+	pinspec.setXSOverride(El+'-'+str(int(A)), 'elastic', E, sigma_n)
+	_slbw_temperatures[(El+'-'+str(int(A)), 'elastic')] = temp
 
 ##
 # @brief Function to convert a string into a float.
@@ -281,24 +258,12 @@ def generatePotentialScattering(isotope, energy_min=1e-5, energy_max=20E6):
     E = numpy.logspace(numpy.log10(energy_min), numpy.log10(energy_max), 2)
     SXS=numpy.zeros_like(E)
     SXS[:]=SigP
-    ESXS = (E, SXS)
-    ESXS = numpy.transpose(ESXS)
     # pull A value from filename
     El, A= isotope.split('-', 1)
     A = float(A)
-    # write output file for scatter XS
-    out_names = pinspec.getXSLibDirectory()+El+'-'+str(int(A))+'-elastic.txt'
-    numpy.savetxt(out_names, ESXS, newline='\n', delimiter=',')
-    # go back and add header
-    g = open(out_names)
-    texts = g.read()
-    g.close()
-    # open the file again for writing
-    g = open(out_names, 'w')
-    g.write('Fictitious resonant scattering XS, values are potential XS\n')
-    # write the original contents
-    g.write(texts)
-    g.close()
+    # register an in-memory override for the scatter XS
+    pinspec.setXSOverride(El+'-'+str(int(A)), 'elastic', E, SXS)
+    _slbw_temperatures.pop((El+'-'+str(int(A)), 'elastic'), None)
 
 ##
 # @brief Function to generate a plot of the SLBW generated cross-section
@@ -313,28 +278,18 @@ def compareXS(isotope, type_xs='capture', dir='.'):
     #Find proper filename for fake XS
     if type_xs=='scatter':
 		type_xs='elastic'
-    path=str(pinspec.getXSLibDirectory())+'/'+El+'-'+A+'-'+type_xs+'.txt'
-    #Read in array for fictitious XS at 300
-    EnT=numpy.array([])
-    barnsT=numpy.array([])
-    invEnT=numpy.array([])
-    with open(path) as resT:
-   	#Parse out String containing Temperature
-	Junk, temp = resT.readline().split('=', 1)
-	for line in resT:
- 	    EnTt, barnsTt=line.split(',', 1)
-	    EnTt=float(EnTt)
-	    barnsTt=float(barnsTt)
-	    invEnTt=1/EnTt
-	    EnT=numpy.append(EnT,EnTt)
-	    barnsT=numpy.append(barnsT,barnsTt)
-	    invEnT=numpy.append(invEnT, invEnTt)
-	
+    if not pinspec.hasXSOverride(isotope, type_xs):
+	py_printf('ERROR', 'Unable to compare the ' + type_xs + ' XS for ' + \
+                       isotope + ' since no SLBW XS has been generated')
+    #Retrieve the fictitious XS from the in-memory overrides
+    num_xs = pinspec.getNumXSOverrideDataPoints(isotope, type_xs)
+    EnT = pinspec.retrieveXSOverrideEnergies(num_xs, isotope, type_xs)
+    barnsT = pinspec.retrieveXSOverride(num_xs, isotope, type_xs)
+    temp = str(_slbw_temperatures.get((isotope, type_xs), 300)) + 'K'
     py_printf('INFO', 'Read in Doppler Broadened XS correctly')
 
     #Read in array for ENDF7 XS at 300
-    npath=str(pinspec.getXSLibDirectory())+'/BackupXS/'+El+'-'+A+'-' + \
-                                                            type_xs+'.txt'
+    npath=str(pinspec.getXSLibDirectory())+'/'+El+'-'+A+'-'+type_xs+'.txt'
     EndfE300=numpy.array([])
     barnsEndF300=numpy.array([])
     invEndfE300=numpy.array([])
@@ -0,0 +1,202 @@
+#include "CompactXS.h"
+
+
+/**
+ * @brief CompactXS constructor encodes an array of cross-section values.
+ * @details For FLOAT16_XS the values are first scaled by the largest power of
+ *          two which keeps the largest value within the half precision range.
+ *          For LOG16_XS the codes are spread evenly in the logarithm between
+ *          the smallest and largest positive values, with a code of zero
+ *          reserved for values which are zero (or negative).
+ * @param xs the array of cross-section values (barns)
+ * @param num_values the number of cross-section values
+ * @param precision the 16-bit format for the values
+ */
+CompactXS::CompactXS(float* xs, int num_values, xsPrecision precision) {
+
+    _precision = precision;
+    _num_values = num_values;
+    /* The values are padded by one such that interpolating from the last
+     * index in the uniform lethargy grid stays within the array */
+    _values = new uint16_t[num_values+1];
+    _log_offset = 0.0;
+    _decode_factor = 1.0;
+
+    if (precision == FLOAT32_XS)
+        log_printf(ERROR, "Unable to create a compact cross-section with "
+                   "32-bit precision");
+
+    /* Find the range of the values */
+    float max_value = 0.0;
+    float min_positive = 0.0;
+
+    for (int i=0; i < num_values; i++) {
+        max_value = std::max(max_value, fabsf(xs[i]));
+        if (xs[i] > 0.0 && (min_positive == 0.0 || xs[i] < min_positive))
+            min_positive = xs[i];
+    }
+
+    if (precision == FLOAT16_XS) {
+
+        /* Scale so that the largest value is just below 65504 */
+        int exponent = 0;
+        if (max_value > 0.0)
+            exponent = int(floor(log2(65504.0 / max_value)));
+
+        float scale = ldexp(1.0, exponent);
+        _decode_factor = ldexp(1.0, -exponent);
+
+        for (int i=0; i < num_values; i++)
+            _values[i] = encodeFloat16(xs[i] * scale);
+    }
+
+    else if (precision == BFLOAT16_XS) {
+        for (int i=0; i < num_values; i++)
+            _values[i] = encodeBFloat16(xs[i]);
+    }
+
+    else if (precision == LOG16_XS) {
+
+        if (min_positive > 0.0) {
+            _log_offset = log(min_positive);
+            _decode_factor = (log(max_value) - _log_offset) / 65534.0;
+        }
+
+        for (int i=0; i < num_values; i++) {
+
+            if (xs[i] <= 0.0)
+                _values[i] = 0;
+            else if (_decode_factor == 0.0)
+                _values[i] = 1;
+            else {
+                double code = (log(xs[i]) - _log_offset) / _decode_factor;
+                _values[i] = 1 + std::min(65534, std::max(0,
+                                                 int(floor(code + 0.5))));
+            }
+        }
+    }
+
+    _values[num_values] = (num_values > 0) ? _values[num_values-1] : 0;
+}
+
+
+/**
+ * @brief CompactXS destructor deletes the encoded values.
+ */
+CompactXS::~CompactXS() {
+    delete [] _values;
+}
+
+
+/**
+ * @brief Returns the format used to store the cross-section values.
+ * @return the cross-section precision
+ */
+xsPrecision CompactXS::getPrecision() const {
+    return _precision;
+}
+
+
+/**
+ * @brief Returns the number of cross-section values.
+ * @return the number of values
+ */
+int CompactXS::getNumValues() const {
+    return _num_values;
+}
+
+
+/**
+ * @brief Computes the maximum relative error of the decoded values with
+ *        respect to the original 32-bit values.
+ * @details Values which are zero are decoded exactly and are skipped.
+ * @param xs the array of the original cross-section values (barns)
+ * @return the maximum relative error
+ */
+float CompactXS::getMaxRelativeError(float* xs) const {
+
+    float max_error = 0.0;
+
+    for (int i=0; i < _num_values; i++) {
+
+        if (xs[i] == 0.0)
+            continue;
+
+        float error = fabsf(getValue(i) - xs[i]) / fabsf(xs[i]);
+        max_error = std::max(max_error, error);
+    }
+
+    return max_error;
+}
+
+
+/**
+ * @brief Converts a 32-bit float into IEEE half precision.
+ * @details The value is rounded to the nearest half precision value, with
+ *          ties rounded to even. Values beyond the half precision range are
+ *          clamped to the largest finite value and values below the smallest
+ *          subnormal value are flushed to zero.
+ * @param value the value to convert
+ * @return the bits for the half precision value
+ */
+uint16_t CompactXS::encodeFloat16(float value) {
+
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(float));
+
+    uint32_t sign = (bits >> 16) & 0x8000;
+    int exponent = int((bits >> 23) & 0xff) - 127 + 15;
+    uint32_t mantissa = bits & 0x7fffff;
+    uint32_t half, remainder, halfway;
+
+    /* Clamp large values (and infinities) to the largest finite value */
+    if (exponent >= 31)
+        return sign | 0x7bff;
+
+    /* Subnormal values in half precision */
+    if (exponent <= 0) {
+
+        if (exponent < -10)
+            return sign;
+
+        mantissa |= 0x800000;
+        int shift = 14 - exponent;
+        half = mantissa >> shift;
+        remainder = mantissa & ((1u << shift) - 1);
+        halfway = 1u << (shift - 1);
+    }
+
+    else {
+        half = (exponent << 10) | (mantissa >> 13);
+        remainder = mantissa & 0x1fff;
+        halfway = 0x1000;
+    }
+
+    /* A carry into the exponent correctly rounds up to the next power of
+     * two (a carry beyond the largest finite value is clamped) */
+    if (remainder > halfway || (remainder == halfway && (half & 1)))
+        half++;
+
+    if (half > 0x7bff)
+        half = 0x7bff;
+
+    return sign | half;
+}
+
+
+/**
+ * @brief Converts a 32-bit float into a brain floating point value.
+ * @details The value is rounded to the nearest value, with ties rounded to
+ *          even.
+ * @param value the value to convert
+ * @return the bits for the brain floating point value
+ */
+uint16_t CompactXS::encodeBFloat16(float value) {
+
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(float));
+
+    bits += 0x7fff + ((bits >> 16) & 1);
+
+    return uint16_t(bits >> 16);
+}
@@ -0,0 +1,139 @@
+/**
+ * @file CompactXS.h
+ * @brief The CompactXS class.
+ * @date October 18, 2026
+ */
+
+#ifndef COMPACTXS_H_
+#define COMPACTXS_H_
+
+#ifdef __cplusplus
+#include <math.h>
+#include <string.h>
+#include <stdint.h>
+#include <algorithm>
+#include "log.h"
+#endif
+
+
+/**
+ * @enum xsPrecisionTypes
+ * @brief The formats for storing cross-sections on the uniform lethargy grid.
+ */
+
+/**
+ * @var xsPrecision
+ * @brief A format for storing cross-sections on the uniform lethargy grid.
+ */
+typedef enum xsPrecisionTypes {
+    /** 32-bit IEEE floating point */
+    FLOAT32_XS,
+    /** 16-bit IEEE half precision floating point, scaled by a power of two
+     *  for each cross-section to fit within the half precision range */
+    FLOAT16_XS,
+    /** 16-bit brain floating point (the upper half of a 32-bit float) */
+    BFLOAT16_XS,
+    /** 16-bit fixed point in the logarithm of the cross-section */
+    LOG16_XS
+} xsPrecision;
+
+
+/** The default format for cross-sections, which may be changed at compile
+ *  time (ie, -DDEFAULT_XS_PRECISION=BFLOAT16_XS) */
+#ifndef DEFAULT_XS_PRECISION
+#define DEFAULT_XS_PRECISION FLOAT32_XS
+#endif
+
+
+/**
+ * @class CompactXS CompactXS.h "pinspec/src/CompactXS.h"
+ * @brief A cross-section on the uniform lethargy grid stored in a 16-bit
+ *        format.
+ * @details Storing cross-sections in 16 bits halves the memory which must
+ *          be read from the uniform lethargy grid for each lookup in the
+ *          collision loop. Values are decoded into 32-bit floats before they
+ *          are interpolated. The maximum relative error of each format is
+ *          roughly:
+ *
+ *          - FLOAT16_XS: \f$ 2^{-11} \f$ for values within \f$ 10^4 \f$ of
+ *            the largest value, increasing for smaller values which are
+ *            subnormal in half precision
+ *          - BFLOAT16_XS: \f$ 2^{-8} \f$ for all values
+ *          - LOG16_XS: half of the logarithmic step between the smallest and
+ *            largest non-zero values over 65534 codes (\f$ 2\times10^{-4} \f$
+ *            for a range of 12 decades)
+ */
+class CompactXS {
+
+private:
+    /** The format used to store the cross-section values */
+    xsPrecision _precision;
+    /** The number of cross-section values */
+    int _num_values;
+    /** The encoded cross-section values */
+    uint16_t* _values;
+    /** The natural logarithm of the smallest non-zero value for LOG16_XS */
+    float _log_offset;
+    /** The factor used to decode each value: the logarithmic step for
+     *  LOG16_XS and the inverse of the power of two scaling for FLOAT16_XS */
+    float _decode_factor;
+
+    static uint16_t encodeFloat16(float value);
+    static uint16_t encodeBFloat16(float value);
+
+public:
+    CompactXS(float* xs, int num_values, xsPrecision precision);
+    virtual ~CompactXS();
+
+    xsPrecision getPrecision() const;
+    int getNumValues() const;
+    float getValue(int index) const;
+    float getMaxRelativeError(float* xs) const;
+};
+
+
+/**
+ * @brief Decodes the cross-section value at some index.
+ * @details Normal half precision values are decoded by shifting their 
+ *          exponent and mantissa into a 32-bit float and rebiasing the 
+ *          exponent. Subnormal half precision values are converted from
+ *          integers since they would be subnormal as 32-bit floats as well,
+ *          which may be flushed to zero when compiled with -ffast-math.
+ * @param index the index into the uniform lethargy grid
+ * @return the decoded cross-section value
+ */
+inline float CompactXS::getValue(int index) const {
+
+    uint32_t bits;
+    float value;
+
+    switch (_precision) {
+
+        case FLOAT16_XS:
+            bits = _values[index] & 0x7fff;
+            if (bits < 0x0400)
+                value = bits * 5.9604645E-8f;
+            else {
+                bits = (bits << 13) + 0x38000000;
+                memcpy(&value, &bits, sizeof(float));
+            }
+            value *= _decode_factor;
+            return (_values[index] & 0x8000) ? -value : value;
+
+        case BFLOAT16_XS:
+            bits = (uint32_t)_values[index] << 16;
+            memcpy(&value, &bits, sizeof(float));
+            return value;
+
+        case LOG16_XS:
+            if (_values[index] == 0)
+                return 0.0;
+            return expf(_log_offset + _decode_factor * (_values[index] - 1));
+
+        default:
+            return 0.0;
+    }
+}
+
+
+#endif /* COMPACTXS_H_ */
@@ -0,0 +1,470 @@
+#include "CompiledGeometry.h"
+#include "TallyBank.h"
+
+
+/**
+ * @brief CompiledGeometry constructor.
+ * @details Flattens the regions, their bounding surfaces and their
+ *          neighbors into arrays indexed by integers, and binds the tallies
+ *          registered in the TallyBank to the regions. The neighbors of each
+ *          region must be found before the regions are compiled.
+ * @param regions the BOUNDED type regions in the geometry
+ */
+CompiledGeometry::CompiledGeometry(std::vector<BoundedRegion*>& regions) {
+
+    surfaceType types[3] = {XPLANE, YPLANE, ZCYLINDER};
+    std::map<Surface*, int> surfaces;
+    int max_uid = 0;
+
+    _num_regions = regions.size();
+    _num_surfaces = 0;
+    _regions = regions;
+
+    for (int r=0; r < _num_regions; r++)
+        max_uid = std::max(max_uid, _regions[r]->getUid());
+
+    _region_indices.assign(max_uid + 1, -1);
+
+    for (int r=0; r < _num_regions; r++)
+        _region_indices[_regions[r]->getUid()] = r;
+
+    _neighbor_offsets.push_back(0);
+    _test_offsets.push_back(0);
+
+    for (int r=0; r < _num_regions; r++) {
+
+        BoundedRegion* region = _regions[r];
+        Material* material = region->getMaterial();
+
+        _materials.push_back(material);
+        _temperatures.push_back(material != NULL ? region->getTemperature()
+                                                 : 0.0);
+
+        /* Group the halfspaces of the region by the type of their surface */
+        for (int t=0; t < 3; t++) {
+
+            _halfspace_offsets.push_back(_halfspace_surfaces.size());
+
+            for (int i=0; i < region->getNumBoundingSurfaces(); i++) {
+
+                Surface* surface = region->getBoundingSurface(i);
+
+                if (surface->getSurfaceType() != types[t])
+                    continue;
+
+                int index = addSurface(surface, surfaces);
+                _halfspace_surfaces.push_back(index);
+                _halfspace_signs.push_back(region->getBoundingHalfspace(i));
+                _halfspace_coefficients.insert(_halfspace_coefficients.end(),
+                                  &_surface_coefficients[3*index],
+                                  &_surface_coefficients[3*index] + 3);
+
+                std::vector<regionNeighbor>* neighbors =
+                                                  region->getNeighbors(i);
+
+                for (int n=0; neighbors != NULL &&
+                         n < int(neighbors->size()); n++) {
+
+                    regionNeighbor& neighbor = neighbors->at(n);
+                    int neighbor_index = getRegionIndex(neighbor._region);
+
+                    if (neighbor_index < 0)
+                        continue;
+
+                    for (int j=0; j < int(neighbor._halfspaces.size()); j++) {
+                        _test_surfaces.push_back(addSurface(
+                                  neighbor._halfspaces[j].second, surfaces));
+                        _test_signs.push_back(neighbor._halfspaces[j].first);
+                    }
+
+                    _neighbor_regions.push_back(neighbor_index);
+                    _test_offsets.push_back(_test_surfaces.size());
+                }
+
+                _neighbor_offsets.push_back(_neighbor_regions.size());
+            }
+        }
+    }
+
+    _halfspace_offsets.push_back(_halfspace_surfaces.size());
+
+    compileTallies();
+
+    log_printf(INFO, "Compiled %d regions with %d surfaces, %d halfspaces and "
+               "%d neighbors", _num_regions, _num_surfaces,
+               getNumHalfspaces(), int(_neighbor_regions.size()));
+}
+
+
+/**
+ * @brief CompiledGeometry destructor.
+ * @details The regions, surfaces, materials and tallies are owned by the
+ *          geometry and the TallyBank and are not deleted.
+ */
+CompiledGeometry::~CompiledGeometry() { }
+
+
+/**
+ * @brief Adds a surface to the compiled surfaces if it has not been added.
+ * @param surface a pointer to the surface
+ * @param surfaces the index of each surface which has been added
+ * @return the index of the surface
+ */
+int CompiledGeometry::addSurface(Surface* surface,
+                                 std::map<Surface*, int>& surfaces) {
+
+    std::map<Surface*, int>::iterator iter = surfaces.find(surface);
+
+    if (iter != surfaces.end())
+        return (*iter).second;
+
+    float coefficients[3] = {0.0, 0.0, 0.0};
+
+    switch (surface->getSurfaceType()) {
+
+        case XPLANE:
+            coefficients[0] = static_cast<XPlane*>(surface)->getX();
+            break;
+
+        case YPLANE:
+            coefficients[0] = static_cast<YPlane*>(surface)->getY();
+            break;
+
+        case ZCYLINDER: {
+            ZCylinder* cylinder = static_cast<ZCylinder*>(surface);
+            float radius = cylinder->getRadius();
+            coefficients[0] = cylinder->getX0();
+            coefficients[1] = cylinder->getY0();
+            coefficients[2] = radius * radius;
+            break;
+        }
+    }
+
+    _surfaces.push_back(surface);
+    _surface_types.push_back(surface->getSurfaceType());
+    _boundary_types.push_back(surface->getBoundaryType());
+    _surface_coefficients.insert(_surface_coefficients.end(), coefficients,
+                                 coefficients + 3);
+
+    surfaces[surface] = _num_surfaces;
+    _num_surfaces++;
+
+    return _num_surfaces - 1;
+}
+
+
+/**
+ * @brief Binds the tallies registered in the TallyBank to the regions,
+ *        materials and isotopes.
+ * @details Each tally is bound in the same order in which the TallyBank
+ *          tallies a neutron.
+ */
+void CompiledGeometry::compileTallies() {
+
+    TallyBank* tally_bank = TallyBank::Get();
+
+    _geometry_tallies = tally_bank->getGeometryTallies();
+
+    _region_tally_offsets.push_back(0);
+
+    for (int r=0; r < _num_regions; r++) {
+        std::vector<Tally*> tallies = tally_bank->getRegionTallies(_regions[r]);
+        _region_tallies.insert(_region_tallies.end(), tallies.begin(),
+                               tallies.end());
+        _region_tally_offsets.push_back(_region_tallies.size());
+    }
+
+    std::map< Material*, std::vector<Tally*> > material_tallies =
+                                          tally_bank->getMaterialTallies();
+    std::map< Material*, std::vector<Tally*> >::iterator material_iter;
+
+    _material_tally_offsets.push_back(0);
+
+    for (material_iter = material_tallies.begin();
+         material_iter != material_tallies.end(); ++material_iter) {
+        _tally_materials.push_back((*material_iter).first);
+        _material_tallies.insert(_material_tallies.end(),
+                                 (*material_iter).second.begin(),
+                                 (*material_iter).second.end());
+        _material_tally_offsets.push_back(_material_tallies.size());
+    }
+
+    std::map< Isotope*, std::vector<Tally*> > isotope_tallies =
+                                          tally_bank->getIsotopeTallies();
+    std::map< Isotope*, std::vector<Tally*> >::iterator isotope_iter;
+
+    _isotope_tally_offsets.push_back(0);
+
+    for (isotope_iter = isotope_tallies.begin();
+         isotope_iter != isotope_tallies.end(); ++isotope_iter) {
+        _tally_isotopes.push_back((*isotope_iter).first);
+        _isotope_tallies.insert(_isotope_tallies.end(),
+                                (*isotope_iter).second.begin(),
+                                (*isotope_iter).second.end());
+        _isotope_tally_offsets.push_back(_isotope_tallies.size());
+    }
+}
+
+
+/**
+ * @brief Returns the number of compiled regions.
+ * @return the number of regions
+ */
+int CompiledGeometry::getNumRegions() const {
+    return _num_regions;
+}
+
+
+/**
+ * @brief Returns the number of compiled surfaces.
+ * @return the number of surfaces
+ */
+int CompiledGeometry::getNumSurfaces() const {
+    return _num_surfaces;
+}
+
+
+/**
+ * @brief Returns the total number of halfspaces bounding the regions.
+ * @return the number of halfspaces
+ */
+int CompiledGeometry::getNumHalfspaces() const {
+    return _halfspace_surfaces.size();
+}
+
+
+/**
+ * @brief Returns a compiled region.
+ * @param index the index of the region
+ * @return a pointer to the region
+ */
+BoundedRegion* CompiledGeometry::getRegion(int index) const {
+
+    if (index < 0 || index >= _num_regions) {
+        log_printf(ERROR, "Unable to return region %d since the compiled "
+                   "geometry has %d regions", index, _num_regions);
+        return NULL;
+    }
+
+    return _regions[index];
+}
+
+
+/**
+ * @brief Returns a compiled surface.
+ * @param index the index of the surface
+ * @return a pointer to the surface
+ */
+Surface* CompiledGeometry::getSurface(int index) const {
+
+    if (index < 0 || index >= _num_surfaces) {
+        log_printf(ERROR, "Unable to return surface %d since the compiled "
+                   "geometry has %d surfaces", index, _num_surfaces);
+        return NULL;
+    }
+
+    return _surfaces[index];
+}
+
+
+/**
+ * @brief Computes the parametrized distance along a neutron's trajectory to
+ *        the nearest halfspace bounding its region.
+ * @details The distances to the planes and cylinders of the region are
+ *          computed from the coefficients stored with its halfspaces. The
+ *          neutron's halfspace index is set to the nearest halfspace, or to
+ *          -1 if no surface is ahead of the neutron.
+ * @param neutron the neutron of interest
+ * @return the parametrized distance to the nearest surface
+ */
+float CompiledGeometry::computeDistance(neutron* neutron) const {
+
+    float x = neutron->_x;
+    float y = neutron->_y;
+    float u = neutron->_u;
+    float v = neutron->_v;
+    float min_dist = std::numeric_limits<int>::max();
+    int min_index = -1;
+
+    const int* offsets = &_halfspace_offsets[3*neutron->_region_index];
+    const float* coefficients = _halfspace_coefficients.data();
+
+    for (int h=offsets[0]; h < offsets[1]; h++) {
+        float dist = computePlaneDistance(x, u, coefficients[3*h]);
+        bool nearer = dist < min_dist;
+        min_dist = nearer ? dist : min_dist;
+        min_index = nearer ? h : min_index;
+    }
+
+    for (int h=offsets[1]; h < offsets[2]; h++) {
+        float dist = computePlaneDistance(y, v, coefficients[3*h]);
+        bool nearer = dist < min_dist;
+        min_dist = nearer ? dist : min_dist;
+        min_index = nearer ? h : min_index;
+    }
+
+    for (int h=offsets[2]; h < offsets[3]; h++) {
+        float dist = computeCylinderDistance(x, y, u, v, coefficients[3*h],
+                                             coefficients[3*h+1],
+                                             coefficients[3*h+2]);
+        bool nearer = dist < min_dist;
+        min_dist = nearer ? dist : min_dist;
+        min_index = nearer ? h : min_index;
+    }
+
+    neutron->_halfspace_index = min_index;
+
+    if (min_index >= 0)
+        neutron->_surface = _surfaces[_halfspace_surfaces[min_index]];
+
+    return min_dist;
+}
+
+
+/**
+ * @brief Finds the region containing a neutron after it was moved by
+ *        trackNeutron().
+ * @details If the neutron is still within the halfspace it moved towards,
+ *          or did not move towards any halfspace, it collided or was
+ *          reflected within its region. Otherwise, it crossed the surface of
+ *          the halfspace and only the neighbors across the halfspace are
+ *          tested.
+ * @param neutron the neutron of interest
+ * @return the index of the region containing the neutron, or -1 if no
+ *         neighbor contains the neutron
+ */
+int CompiledGeometry::findNextRegion(neutron* neutron) const {
+
+    int region = neutron->_region_index;
+    int halfspace = neutron->_halfspace_index;
+    float x = neutron->_x;
+    float y = neutron->_y;
+
+    if (halfspace < 0 || _halfspace_signs[halfspace] *
+        evaluate(_halfspace_surfaces[halfspace], x, y) > 0)
+        return region;
+
+    for (int n=_neighbor_offsets[halfspace];
+         n < _neighbor_offsets[halfspace+1]; n++) {
+
+        bool contained = true;
+
+        for (int t=_test_offsets[n]; t < _test_offsets[n+1]; t++) {
+            if (_test_signs[t] * evaluate(_test_surfaces[t], x, y) < -1E-6) {
+                contained = false;
+                break;
+            }
+        }
+
+        if (contained)
+            return _neighbor_regions[n];
+    }
+
+    return -1;
+}
+
+
+/**
+ * @brief Moves a neutron to its next collision or surface crossing within
+ *        its region.
+ * @details This is the compiled form of BoundedRegion::collideNeutron(). A
+ *          neutron which crosses an INTERFACE surface is nudged across it,
+ *          a neutron which reaches a REFLECTIVE surface is reflected and a
+ *          neutron which reaches a VACUUM surface is killed.
+ * @param neutron the neutron of interest
+ */
+void CompiledGeometry::trackNeutron(neutron* neutron) const {
+
+    int region = neutron->_region_index;
+    Material* material = _materials[region];
+
+    if (material == NULL) {
+        log_printf(ERROR, "Region %s must have material to collide neutron",
+                   _regions[region]->getName());
+        neutron->_alive = false;
+        return;
+    }
+
+    neutron->_temperature = _temperatures[region];
+
+    float path_length = material->sampleDistanceTraveled(neutron);
+    float surf_dist = computeDistance(neutron);
+
+    /* The neutron collided within its region */
+    if (path_length < surf_dist) {
+
+        neutron->_region = _regions[region];
+        neutron->_path_length = path_length;
+
+        neutron->_x += path_length * neutron->_u;
+        neutron->_y += path_length * neutron->_v;
+        neutron->_z += path_length * neutron->_w;
+
+        material->collideNeutron(neutron);
+        return;
+    }
+
+    /* The neutron reached a bounding surface of its region */
+    neutron->_path_length = surf_dist;
+    int surface = _halfspace_surfaces[neutron->_halfspace_index];
+
+    switch (_boundary_types[surface]) {
+
+        case INTERFACE:
+            surf_dist += TINY_MOVE;
+            neutron->_x += surf_dist * neutron->_u;
+            neutron->_y += surf_dist * neutron->_v;
+            neutron->_z += surf_dist * neutron->_w;
+            break;
+
+        case REFLECTIVE:
+            neutron->_x += surf_dist * neutron->_u;
+            neutron->_y += surf_dist * neutron->_v;
+            neutron->_z += surf_dist * neutron->_w;
+            _surfaces[surface]->reflectNeutron(neutron);
+            break;
+
+        default:
+            neutron->_x += surf_dist * neutron->_u;
+            neutron->_y += surf_dist * neutron->_v;
+            neutron->_z += surf_dist * neutron->_w;
+            neutron->_alive = false;
+    }
+}
+
+
+/**
+ * @brief Tallies a neutron in the tallies for the geometry, its region, its
+ *        material and its isotope.
+ * @details This is the compiled form of TallyBank::tally().
+ * @param neutron the neutron of interest
+ */
+void CompiledGeometry::tally(neutron* neutron) const {
+
+    for (int i=0; i < int(_geometry_tallies.size()); i++)
+        _geometry_tallies[i]->tally(neutron);
+
+    int region = neutron->_region_index;
+
+    if (region >= 0) {
+        for (int i=_region_tally_offsets[region];
+             i < _region_tally_offsets[region+1]; i++)
+            _region_tallies[i]->tally(neutron);
+    }
+
+    for (int m=0; m < int(_tally_materials.size()); m++) {
+        if (_tally_materials[m] == neutron->_material) {
+            for (int i=_material_tally_offsets[m];
+                 i < _material_tally_offsets[m+1]; i++)
+                _material_tallies[i]->tally(neutron);
+        }
+    }
+
+    for (int n=0; n < int(_tally_isotopes.size()); n++) {
+        if (_tally_isotopes[n] == neutron->_isotope) {
+            for (int i=_isotope_tally_offsets[n];
+                 i < _isotope_tally_offsets[n+1]; i++)
+                _isotope_tallies[i]->tally(neutron);
+        }
+    }
+}
@@ -0,0 +1,180 @@
+/**
+ * @file CompiledGeometry.h
+ * @brief The CompiledGeometry class.
+ * @date October 18, 2026
+ */
+
+#ifndef COMPILEDGEOMETRY_H_
+#define COMPILEDGEOMETRY_H_
+
+#ifdef __cplusplus
+#include <vector>
+#include <map>
+#include <limits>
+#include <algorithm>
+#include "Region.h"
+#include "Surface.h"
+#include "Tally.h"
+#include "log.h"
+#endif
+
+
+/**
+ * @class CompiledGeometry CompiledGeometry.h "pinspec/src/CompiledGeometry.h"
+ * @brief A CompiledGeometry is a flattened copy of the regions, surfaces,
+ *        neighbors, materials and tallies of a HETEROGENEOUS geometry in
+ *        contiguous arrays indexed by integers.
+ * @details The geometry is compiled when a simulation is run, after the
+ *          neighbors of each region have been found, and neutrons are then
+ *          tracked from their region and halfspace indices rather than
+ *          through the BoundedRegion and Surface objects. The halfspaces of
+ *          each region are stored contiguously and grouped by surface type
+ *          with a copy of their surface's coefficients, such that the
+ *          distance to the nearest surface is computed without virtual
+ *          calls or pointer chasing. The regions across each halfspace and
+ *          the halfspaces which must be tested to find if a neutron is
+ *          within each of them are stored in compressed rows. The tallies
+ *          registered in the TallyBank are bound to the regions, materials
+ *          and isotopes of the geometry when it is compiled, such that a
+ *          neutron is tallied without copying or searching the TallyBank's
+ *          tables. A geometry must be compiled again after its regions,
+ *          surfaces, materials or tallies are changed.
+ */
+class CompiledGeometry {
+
+private:
+    /** The number of regions */
+    int _num_regions;
+    /** The number of surfaces */
+    int _num_surfaces;
+
+    /** The regions, in the order in which they were compiled */
+    std::vector<BoundedRegion*> _regions;
+    /** The material filling each region */
+    std::vector<Material*> _materials;
+    /** The temperature of each region (K) */
+    std::vector<float> _temperatures;
+    /** The index of each region, indexed by the region's unique identifier,
+     *  or -1 for regions which were not compiled */
+    std::vector<int> _region_indices;
+
+    /** The surfaces bounding the regions */
+    std::vector<Surface*> _surfaces;
+    /** The type of each surface */
+    std::vector<surfaceType> _surface_types;
+    /** The boundary type of each surface */
+    std::vector<boundaryType> _boundary_types;
+    /** The coefficients of each surface: the location of a plane, or the x-
+     *  and y-coordinates of the center and the squared radius of a
+     *  cylinder */
+    std::vector<float> _surface_coefficients;
+
+    /** The offsets into the halfspaces of the XPlanes, YPlanes and
+     *  ZCylinders bounding each region, followed by the offset of the next
+     *  region's halfspaces */
+    std::vector<int> _halfspace_offsets;
+    /** The surface of each halfspace */
+    std::vector<int> _halfspace_surfaces;
+    /** The sign of each halfspace (+1 or -1) */
+    std::vector<int> _halfspace_signs;
+    /** A copy of the coefficients of the surface of each halfspace */
+    std::vector<float> _halfspace_coefficients;
+
+    /** The offsets into the neighbors across each halfspace */
+    std::vector<int> _neighbor_offsets;
+    /** The region of each neighbor */
+    std::vector<int> _neighbor_regions;
+    /** The offsets into the tested halfspaces for each neighbor */
+    std::vector<int> _test_offsets;
+    /** The surface of each halfspace tested for a neighbor */
+    std::vector<int> _test_surfaces;
+    /** The sign of each halfspace tested for a neighbor */
+    std::vector<int> _test_signs;
+
+    /** The tallies registered for the geometry */
+    std::vector<Tally*> _geometry_tallies;
+    /** The offsets into the tallies bound to each region */
+    std::vector<int> _region_tally_offsets;
+    /** The tallies registered for each region */
+    std::vector<Tally*> _region_tallies;
+    /** The materials for which tallies are registered */
+    std::vector<Material*> _tally_materials;
+    /** The offsets into the tallies bound to each material */
+    std::vector<int> _material_tally_offsets;
+    /** The tallies registered for each material */
+    std::vector<Tally*> _material_tallies;
+    /** The isotopes for which tallies are registered */
+    std::vector<Isotope*> _tally_isotopes;
+    /** The offsets into the tallies bound to each isotope */
+    std::vector<int> _isotope_tally_offsets;
+    /** The tallies registered for each isotope */
+    std::vector<Tally*> _isotope_tallies;
+
+    int addSurface(Surface* surface, std::map<Surface*, int>& surfaces);
+    void compileTallies();
+
+public:
+    CompiledGeometry(std::vector<BoundedRegion*>& regions);
+    virtual ~CompiledGeometry();
+
+    int getNumRegions() const;
+    int getNumSurfaces() const;
+    int getNumHalfspaces() const;
+    BoundedRegion* getRegion(int index) const;
+    Surface* getSurface(int index) const;
+    int getRegionIndex(Region* region) const;
+
+    float evaluate(int surface, float x, float y) const;
+    float computeDistance(neutron* neutron) const;
+    int findNextRegion(neutron* neutron) const;
+    void trackNeutron(neutron* neutron) const;
+    void tally(neutron* neutron) const;
+};
+
+
+/**
+ * @brief Returns the index of a compiled region.
+ * @param region a pointer to the region
+ * @return the index of the region, or -1 if the region was not compiled
+ */
+inline int CompiledGeometry::getRegionIndex(Region* region) const {
+
+    int uid = region->getUid();
+
+    if (uid < 0 || uid >= int(_region_indices.size()))
+        return -1;
+
+    return _region_indices[uid];
+}
+
+
+/**
+ * @brief Evaluates the equation of a surface at a point in the xy-plane.
+ * @param surface the index of the surface
+ * @param x the x-coordinate of interest
+ * @param y the y-coordinate of interest
+ * @return the value of the surface's equation, which is positive in the
+ *         surface's positive halfspace
+ */
+inline float CompiledGeometry::evaluate(int surface, float x, float y) const {
+
+    const float* coefficients = &_surface_coefficients[3*surface];
+
+    switch (_surface_types[surface]) {
+
+        case XPLANE:
+            return x - coefficients[0];
+
+        case YPLANE:
+            return y - coefficients[0];
+
+        default: {
+            float dx = x - coefficients[0];
+            float dy = y - coefficients[1];
+            return dx * dx + dy * dy - coefficients[2];
+        }
+    }
+}
+
+
+#endif /* COMPILEDGEOMETRY_H_ */
@@ -93,25 +93,26 @@ float Fissioner::wattSpectrum(float energy) {
 
 
 /**
- * @brief Sample the Fissioner's CDF and return a neutron energy from fission
+ * @brief Sample the Watt spectrum and return a neutron energy from fission
+ * @details The Watt spectrum is sampled directly rather than from the CDF, 
+ *          and energies above the maximum energy of the CDF are rejected.
  * @return a neutron energy in MeV
  * @see Fissioner::emitNeutroneV()
  */
 float Fissioner::emitNeutronMeV() {
 
-    /* Check that the CDF has been built */
-    if (_num_bins == 0)
-        log_printf(ERROR, "Unable to sample Fissioner CDF since it "
-	 			"has not yet been created");
+    float energy;
 
-    /* Return an interpolate value from the fission energy CDF */
-    return linearInterp<float, float, float>(_cdf, _cdf_energies, _num_bins,
-					     float(rand()) / RAND_MAX);
+    do {
+        energy = Source::sampleWatt(1.0 / 1.036, 2.29);
+    } while (energy > _E_max);
+
+    return energy;
 }
 
 
 /**
- * @brief Sample the Fissioner's CDF and return a neutron energy from fission
+ * @brief Sample the Watt spectrum and return a neutron energy from fission
  * @return a neutron energy in eV
  * @see Fissioner::emitNeutronMeV()
  */
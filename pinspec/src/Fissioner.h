@@ -13,6 +13,7 @@
 #include "integrate.h"
 #include "interpolate.h"
 #include "arraycreator.h"
+#include "Source.h"
 #endif
 
 
@@ -22,9 +23,9 @@
  * @brief The Fissioner represents the physics of fission neutron emission.
  * @details The Fissioner class contains a cumulative distribution 
  *          function (CDF) for the chi spectrum of fission neutron energies. The
- *          Fissioner can stochastically sample from the CDF to generate 
- *          the neutron fission emisson spectrum. The Watt spectrum given in 
- *          the "Fundamentals of Nuclear Reactor Physics", E. E. Lewis is
+ *          Fissioner samples the neutron fission emission spectrum directly
+ *          with the Source's Watt spectrum sampler. The Watt spectrum given 
+ *          in the "Fundamentals of Nuclear Reactor Physics", E. E. Lewis is
  *          used to generate the CDF:
  *          
  *          \f$ \chi = 0.453 * exp(-1.036E) * sinh(\sqrt{2.29E}) \f$
@@ -21,6 +21,7 @@ Geometry::Geometry(spatialType spatial_type, const char* name) {
     _infinite_medium = NULL;
     _fuel = NULL;
     _moderator = NULL;
+    _lattice = NULL;
 
     /* Default equivalent geometry parameters */
     _fuel_radius = 0.45;
@@ -35,9 +36,22 @@ Geometry::Geometry(spatialType spatial_type, const char* name) {
     /* Default dancoff factor is non-physical to allow for error checking */
     _dancoff = -1.0;
 
-    /* Initialize a fissioner with a fission spectrum and sampling CDF */
-    _fissioner = new Fissioner();
+    /* Initialize a source with a Watt fission spectrum */
+    _source = new Source();
     _source_sampling_radius = 2.0;
+    _source_regions_found = false;
+
+    /* The regions are searched linearly until the grid is built */
+    _grid_nx = 0;
+    _grid_ny = 0;
+    _region_neighbors_found = false;
+
+    /* Neutrons are surface tracked by default */
+    _delta_tracking = false;
+    _delta_tracking_ratio = 0.1;
+    _majorant_material = NULL;
+    _compiled = NULL;
+    _volumes_computed = false;
 }
 
 
@@ -46,7 +60,8 @@ Geometry::Geometry(spatialType spatial_type, const char* name) {
  *        tallies during garbage collection.
  */
 Geometry::~Geometry() { 
-    delete _fissioner;
+    delete _source;
+    delete _compiled;
 
     if (_spatial_type == HOMOGENEOUS_EQUIVALENCE && _num_prob > 0) {
         delete [] _prob_ff;
@@ -122,6 +137,9 @@ float Geometry::getBucklingSquared() {
 
 /**
  * @brief Returns the total volume occuppied by the geometry.
+ * @details The volume of a HETEROGENEOUS geometry filled by a lattice is 
+ *          the area of the lattice, and otherwise is the sum of the volumes
+ *          of its regions.
  * @return The total volume for the geometry
  */
 float Geometry::getVolume() {
@@ -129,8 +147,17 @@ float Geometry::getVolume() {
         return _infinite_medium->getVolume();
     else if (_spatial_type == HOMOGENEOUS_EQUIVALENCE)
         return _fuel->getVolume() + _moderator->getVolume();
-    else
-        return 1.0;     //FIXME: Update this for heterogeneous case when implemented
+    else if (_lattice != NULL)
+        return _lattice->getNumX() * _lattice->getWidthX() * 
+               _lattice->getNumY() * _lattice->getWidthY();
+
+    float volume = 0.0;
+
+    std::vector<BoundedRegion*>::iterator iter;
+    for (iter = _regions.begin(); iter != _regions.end(); ++iter)
+        volume += (*iter)->getVolume();
+
+    return volume;
 }
 
 
@@ -144,6 +171,44 @@ float Geometry::getSourceSamplingRadius() {
 }
 
 
+/**
+ * @brief Returns the source used to sample the energies of source neutrons.
+ * @details The source defaults to a Watt fission spectrum and may be changed
+ *          from within Python as follows:
+ *
+ * @code
+ *          geometry.getSource().setMonoenergetic(2E6)
+ * @endcode
+ *
+ * @return a pointer to the geometry's source
+ */
+Source* Geometry::getSource() {
+    return _source;
+}
+
+
+/**
+ * @brief Returns the lattice filling a HETEROGENEOUS geometry.
+ * @return a pointer to the lattice, or NULL if the geometry is filled by
+ *         its regions
+ */
+Lattice* Geometry::getLattice() {
+    return _lattice;
+}
+
+
+/**
+ * @brief Returns the compiled form of a HETEROGENEOUS geometry on which
+ *        neutrons are tracked.
+ * @details The geometry is compiled each time a simulation is run.
+ * @return a pointer to the compiled geometry, or NULL if the geometry has 
+ *         not been compiled since it last changed
+ */
+CompiledGeometry* Geometry::getCompiledGeometry() {
+    return _compiled;
+}
+
+
 /**
  * @brief Sets the name of the geometry.
  * @param name the name of the geometry
@@ -160,6 +225,7 @@ void Geometry::setName(const char* name) {
  */
 void Geometry::setSourceSamplingRadius(float radius) {
     _source_sampling_radius = radius;
+    _source_regions_found = false;
 }
 
 
@@ -234,6 +300,35 @@ void Geometry::setDancoffFactor(float dancoff) {
 }
 
 
+/**
+ * @brief Sets whether neutrons are transported by Woodcock delta tracking
+ *        in a HETEROGENEOUS geometry.
+ * @details With delta tracking, the distance to each collision is sampled
+ *          from a majorant of the total cross-sections of all materials, 
+ *          and a collision at a point in a region is a real collision with
+ *          the probability of the ratio of the region's total cross-section 
+ *          to the majorant. The regions are only searched for the collision
+ *          points rather than at each surface crossing. Neutrons in regions
+ *          where the ratio is less than some minimum, such as in the 
+ *          moderator at the energies of the U-238 resonances, are instead 
+ *          surface tracked to their next collision or surface crossing.
+ * @param delta_tracking whether or not to delta track neutrons
+ * @param min_ratio the minimum ratio of the total cross-section in a
+ *        neutron's region to the majorant to delta track the neutron
+ */
+void Geometry::setDeltaTracking(bool delta_tracking, float min_ratio) {
+
+    if (min_ratio < 0.0 || min_ratio > 1.0) {
+        log_printf(ERROR, "Unable to set a minimum delta tracking ratio of "
+                   "%f since it must be between 0 and 1", min_ratio);
+        return;
+    }
+
+    _delta_tracking = delta_tracking;
+    _delta_tracking_ratio = min_ratio;
+}
+
+
 /**
  * @brief Set the geometry's spatial type
  *        (INFINITE_HOMOGENEOUS, HOMOGENEOUS_EQUIVALENCE or HETEROGENEOUS).
@@ -272,6 +367,17 @@ void Geometry::setSpatialType(spatialType spatial_type) {
  */
 void Geometry::addRegion(Region* region) {
 
+    /* The source regions are found again when the next neutron is sampled 
+     * and the regions are searched linearly until the grid and neighbors
+     * are rebuilt */
+    _source_regions_found = false;
+    _grid_nx = 0;
+    _grid_ny = 0;
+    _region_neighbors_found = false;
+    delete _compiled;
+    _compiled = NULL;
+    _volumes_computed = false;
+
     if (region->getRegionType() == INFINITE_MEDIUM) {
         if (_fuel != NULL)
 	    log_printf(ERROR, "Unable to add an INFINITE type region %s"
@@ -323,6 +429,11 @@ void Geometry::addRegion(Region* region) {
 		       " region %s", region->getName(), 
 		       _fuel->getName());
     }
+    else if (_lattice != NULL)
+        log_printf(ERROR, "Unable to add region %s to the geometry since it "
+                   "is filled by lattice %s, so the region must be added to "
+                   "a universe in the lattice", region->getName(), 
+                   _lattice->getName());
     else if (region->getRegionType() == BOUNDED_GENERAL) {
         _regions.push_back(static_cast<BoundedRegion*>(region));
     }
@@ -338,6 +449,53 @@ void Geometry::addRegion(Region* region) {
 }
 
 
+/**
+ * @brief Fills a HETEROGENEOUS geometry with a lattice of universes.
+ * @details The regions of the geometry are those of the universes in the
+ *          lattice, which are shared between each of the cells filled by 
+ *          the same universe. The lattice cell containing a neutron is found
+ *          by integer division of its position, and only the regions of the
+ *          universe in that cell are searched in the cell's local 
+ *          coordinates. A user may fill a geometry with a lattice from 
+ *          within Python as follows:
+ *
+ * @code
+ *          lattice = Lattice(17, 17, 1.26, 1.26)
+ *          lattice.fillUniverse(pin)
+ *          geometry.setLattice(lattice)
+ * @endcode
+ *
+ * @param lattice the lattice filling the geometry
+ */
+void Geometry::setLattice(Lattice* lattice) {
+
+    if (_spatial_type != HETEROGENEOUS) {
+        log_printf(ERROR, "Unable to fill geometry %s with lattice %s since "
+                   "it is not a HETEROGENEOUS type geometry", _geometry_name,
+                   lattice->getName());
+        return;
+    }
+
+    if (_lattice == NULL && !_regions.empty()) {
+        log_printf(ERROR, "Unable to fill geometry %s with lattice %s since "
+                   "it already contains BOUNDED type regions", _geometry_name,
+                   lattice->getName());
+        return;
+    }
+
+    /* The regions are found from the lattice when the simulation is run */
+    _lattice = lattice;
+    _regions.clear();
+    _source_regions_found = false;
+    _grid_nx = 0;
+    _grid_ny = 0;
+    _region_neighbors_found = false;
+    delete _compiled;
+    _compiled = NULL;
+    _volumes_computed = false;
+}
+
+
 /**
  * @brief Determines whether or not the geometry contains this neutron.
  * @details If the geometry contains this neutron's location, sets the 
@@ -354,14 +512,13 @@ bool Geometry::contains(neutron* neutron) {
         || _spatial_type == HOMOGENEOUS_EQUIVALENCE)
         return true;
 
-    /* If the geometry is heterogeneous, loop over all regions to find
-     * if any contains this neutron */
-    std::vector<BoundedRegion*>::iterator iter;
-    for (iter = _regions.begin(); iter != _regions.end(); ++iter) {
-        if ((*iter)->contains(neutron)) {
-	    neutron->_region = (*iter);
-            return true;
-        }
+    /* If the geometry is heterogeneous, find if any region contains 
+     * this neutron */
+    BoundedRegion* region = findRegion(neutron);
+
+    if (region != NULL) {
+        neutron->_region = region;
+        return true;
     }
 
     /* If no containing region was found, return false */
@@ -384,27 +541,25 @@ bool Geometry::contains(float x, float y, float z) {
         return true;
     else if (_spatial_type == HOMOGENEOUS_EQUIVALENCE)
       return true;
-    else {
-
-        /* Loop over all of a HETEROGENOUS geometery's regions */
-        std::vector<BoundedRegion*>::iterator iter;
-        for (iter = _regions.begin(); iter != _regions.end(); ++iter) {
-
-	    /* If this region contains the neutron */
-	    if ((*iter)->contains(x, y, z))
-	      return true;
-	}
-        
-        /* None of the geomtry's regions contained the neutron */
-        return NULL;
-    }
+    /* Find if any of a HETEROGENOUS geometery's regions contain the point */
+    else
+        return (findRegion(x, y, z) != NULL);
 }
 
 
 /**
  * @brief Finds the region containing a neutron.
  * @details Finds the region and sets the neutron struct's region pointer 
- *          to this region. If no region is found, throws exception.
+ *          to this region. If no region is found, throws exception. Once
+ *          the neighbors of each region have been found, a neutron which
+ *          crossed a surface of its region is looked for in the regions 
+ *          across that surface, and a neutron which collided or reflected
+ *          within its region remains in that region, without searching all
+ *          of the regions. Once the geometry has been compiled, the regions
+ *          across the surface are found from the neutron's region and 
+ *          halfspace indices. If the geometry is filled by a lattice, a 
+ *          neutron which crossed an edge of its lattice cell is first moved
+ *          into the adjacent cell.
  *
  * @param neutron the neutron of interest
  */
@@ -416,16 +571,52 @@ void Geometry::findContainingRegion(neutron* neutron) {
         || _spatial_type == HOMOGENEOUS_EQUIVALENCE)
             return;
 
-    /* If the geometry is heterogeneous, loop over all regions to find
-     * one which contains this neutron */
-    std::vector<BoundedRegion*>::iterator iter;
-    for (iter = _regions.begin(); iter != _regions.end(); ++iter) {
-        if ((*iter)->contains(neutron)) {
-	    neutron->_region = (*iter);
+    /* A neutron which crossed an edge of its lattice cell is looked for in
+     * the universe of the adjacent cell */
+    bool moved = (_lattice != NULL && _lattice->updateCell(neutron));
+
+    /* Find the region from the neutron's region and the regions across the
+     * halfspace the neutron last moved towards in the compiled geometry */
+    if (_compiled != NULL && neutron->_region_index >= 0) {
+
+        int next = moved ? -1 : _compiled->findNextRegion(neutron);
+
+        if (next >= 0) {
+            neutron->_region_index = next;
+            neutron->_region = _compiled->getRegion(next);
             return;
         }
     }
 
+    /* Find the region from the neutron's current region and the regions 
+     * across the last surface the neutron moved towards */
+    else if (_region_neighbors_found && neutron->_region != NULL && 
+        neutron->_surface != NULL && !moved) {
+
+        BoundedRegion* current = static_cast<BoundedRegion*>(neutron->_region);
+        BoundedRegion* next = current->findNextRegion(neutron);
+
+        if (next != NULL) {
+            neutron->_region = next;
+            return;
+        }
+    }
+
+    /* If the geometry is heterogeneous, find the region which contains 
+     * this neutron */
+    BoundedRegion* region = findRegion(neutron);
+
+    if (region != NULL) {
+        neutron->_region = region;
+
+        if (_compiled != NULL) {
+            neutron->_region_index = _compiled->getRegionIndex(region);
+            neutron->_halfspace_index = -1;
+        }
+
+        return;
+    }
+
     /* If no containing region was found, throw exception */
     log_printf(WARNING, "Unable to find the region containing neutron at "
 	       "(x,y,z) = (%f,%f,%f)", neutron->_x, neutron->_y, neutron->_z);
@@ -449,18 +640,639 @@ Region* Geometry::findContainingRegion(float x, float y, float z) {
     if (_spatial_type == HOMOGENEOUS_EQUIVALENCE)
         return NULL;
 
-    /* If the geometry is HETEROGENEOUS, loop over all regions to find
-     * one which contains this neutron */
+    /* If the geometry is HETEROGENEOUS, find the region which contains 
+     * this point */
+    return findRegion(x, y, z);
+}
+
+
+/**
+ * @brief Finds the unique identifiers of the regions or materials at each
+ *        pixel of a slice through a HETEROGENEOUS geometry.
+ * @details The pixels are on a uniform grid which includes the limits of 
+ *          each axis of the slice, and the rows of pixels are located in 
+ *          parallel by the uniform grid or lattice. The first axis of an XY,
+ *          XZ or YZ slice is the x, x or y axis, and the second axis is the
+ *          y, z or z axis, respectively. A pixel outside of the geometry or
+ *          in a region without a material is zero. A user may plot a slice
+ *          from within Python as follows:
+ *
+ * @code
+ *          uids = geometry.rasterizeSlice(100*100, 'XY', 0., -2., 2., -2.,
+ *                                         2., 100).reshape(100, 100)
+ *          pylab.pcolor(uids)
+ * @endcode
+ *
+ * @param uids an array of the unique identifiers at each pixel, with the
+ *        pixels along the first axis stored contiguously
+ * @param num_pixels the number of pixels
+ * @param plane the plane of the slice (XY, XZ or YZ)
+ * @param location the coordinate of the slice along the third axis
+ * @param min1 the minimum coordinate along the first axis
+ * @param max1 the maximum coordinate along the first axis
+ * @param min2 the minimum coordinate along the second axis
+ * @param max2 the maximum coordinate along the second axis
+ * @param num1 the number of pixels along the first axis
+ * @param material_uids whether to find the materials (true) or the regions
+ *        (false) at the pixels
+ */
+void Geometry::rasterizeSlice(int* uids, int num_pixels, char* plane, 
+                              float location, float min1, float max1,
+                              float min2, float max2, int num1, 
+                              bool material_uids) {
+
+    memset(uids, 0, num_pixels * sizeof(int));
+
+    /* The indices of the coordinates along each axis of the slice */
+    int axis1, axis2, axis3;
+
+    if (!strcmp(plane, "XY") || !strcmp(plane, "xy")) {
+        axis1 = 0;
+        axis2 = 1;
+        axis3 = 2;
+    }
+    else if (!strcmp(plane, "XZ") || !strcmp(plane, "xz")) {
+        axis1 = 0;
+        axis2 = 2;
+        axis3 = 1;
+    }
+    else if (!strcmp(plane, "YZ") || !strcmp(plane, "yz")) {
+        axis1 = 1;
+        axis2 = 2;
+        axis3 = 0;
+    }
+    else {
+        log_printf(ERROR, "Unable to rasterize a %s slice of geometry %s "
+                   "since only XY, XZ and YZ slices are supported", plane,
+                   _geometry_name);
+        return;
+    }
+
+    if (_spatial_type != HETEROGENEOUS) {
+        log_printf(ERROR, "Unable to rasterize a %s slice of geometry %s "
+                   "since it is not a HETEROGENEOUS type geometry", plane,
+                   _geometry_name);
+        return;
+    }
+
+    if (num1 <= 0 || num_pixels % num1 != 0) {
+        log_printf(ERROR, "Unable to rasterize a %s slice of geometry %s "
+                   "since %d pixels are not a whole number of rows of %d "
+                   "pixels", plane, _geometry_name, num_pixels, num1);
+        return;
+    }
+
+    if (_lattice == NULL && _grid_nx == 0)
+        initializeRegionGrid();
+
+    int num2 = num_pixels / num1;
+    float delta1 = (num1 > 1) ? (max1 - min1) / (num1 - 1) : 0.0;
+    float delta2 = (num2 > 1) ? (max2 - min2) / (num2 - 1) : 0.0;
+
+    omp_set_num_threads(_num_threads);
+
+    #pragma omp parallel for
+    for (int j=0; j < num2; j++) {
+
+        float point[3];
+        point[axis2] = min2 + j * delta2;
+        point[axis3] = location;
+
+        for (int i=0; i < num1; i++) {
+
+            point[axis1] = min1 + i * delta1;
+            BoundedRegion* region = findRegion(point[0], point[1], point[2]);
+
+            if (region == NULL)
+                continue;
+
+            if (!material_uids)
+                uids[j * num1 + i] = region->getUid();
+            else if (region->getMaterial() != NULL)
+                uids[j * num1 + i] = region->getMaterial()->getUid();
+        }
+    }
+}
+
+
+/**
+ * @brief Finds the region containing a neutron in a HETEROGENEOUS geometry.
+ * @details If the geometry is filled by a lattice, the regions of the 
+ *          universe in the neutron's lattice cell are tested in the cell's
+ *          local coordinates. If the uniform grid has been built and 
+ *          contains the neutron, only the regions overlapping the neutron's
+ *          grid cell are tested. Otherwise each of the regions is tested. In
+ *          each case the regions are tested in the order they were added.
+ * @param neutron the neutron of interest
+ * @return a pointer to the region, or NULL if no region was found
+ */
+BoundedRegion* Geometry::findRegion(neutron* neutron) {
+
+    if (_lattice != NULL) {
+        if (neutron->_cell < 0)
+            return NULL;
+        return _lattice->getUniverse(neutron->_cell)->findRegion(neutron);
+    }
+
+    int cell = getGridCell(neutron->_x, neutron->_y);
+
+    if (cell >= 0) {
+        for (int i=_grid_offsets[cell]; i < _grid_offsets[cell+1]; i++) {
+            if (_grid_regions[i]->contains(neutron))
+                return _grid_regions[i];
+        }
+        return NULL;
+    }
+
+    std::vector<BoundedRegion*>::iterator iter;
+    for (iter = _regions.begin(); iter != _regions.end(); ++iter) {
+        if ((*iter)->contains(neutron))
+            return (*iter);
+    }
+
+    return NULL;
+}
+
+
+/**
+ * @brief Finds the region containing a point in a HETEROGENEOUS geometry.
+ * @details If the geometry is filled by a lattice, the regions of the 
+ *          universe in the point's lattice cell are tested in the cell's
+ *          local coordinates. If the uniform grid has been built and contains
+ *          the point, only the regions overlapping the point's grid cell are
+ *          tested. Otherwise each of the regions is tested.
+ * @param x the x-coordinate of interest
+ * @param y the y-coordinate of interest
+ * @param z the z-coordinate of interest
+ * @return a pointer to the region, or NULL if no region was found
+ */
+BoundedRegion* Geometry::findRegion(float x, float y, float z) {
+
+    if (_lattice != NULL) {
+
+        int cell = _lattice->getCell(x, y);
+
+        if (cell < 0 || _lattice->getUniverse(cell) == NULL)
+            return NULL;
+
+        return _lattice->getUniverse(cell)->findRegion(
+                   x - _lattice->getCellCenterX(cell),
+                   y - _lattice->getCellCenterY(cell), z);
+    }
+
+    int cell = getGridCell(x, y);
+
+    if (cell >= 0) {
+        for (int i=_grid_offsets[cell]; i < _grid_offsets[cell+1]; i++) {
+            if (_grid_regions[i]->contains(x, y, z))
+                return _grid_regions[i];
+        }
+        return NULL;
+    }
+
     std::vector<BoundedRegion*>::iterator iter;
     for (iter = _regions.begin(); iter != _regions.end(); ++iter) {
         if ((*iter)->contains(x, y, z))
-	    return (*iter);
+            return (*iter);
     }
 
     return NULL;
 }
 
 
+/**
+ * @brief Computes the parametrized distance along a neutron's trajectory to
+ *        the nearest REFLECTIVE or VACUUM surface bounding the geometry.
+ * @details The neutron's surface is set to the nearest boundary surface.
+ *          A neutron which was reflected from a surface may be left just
+ *          beyond it by round-off, so the surface it was reflected from is
+ *          not crossed again within a tiny distance.
+ * @param neutron the neutron of interest
+ * @param reflected the surface the neutron was reflected from, if any
+ * @return the parametrized distance to the nearest boundary surface
+ */
+float Geometry::computeBoundaryDistance(neutron* neutron, Surface* reflected) {
+
+    float min_dist = std::numeric_limits<int>::max();
+    float curr_dist;
+
+    std::vector<Surface*>::iterator iter;
+    for (iter = _boundary_surfaces.begin(); iter != _boundary_surfaces.end();
+         ++iter) {
+
+        curr_dist = (*iter)->computeParametrizedDistance(neutron);
+
+        if (*iter == reflected && curr_dist < TINY_MOVE)
+            continue;
+
+        if (curr_dist < min_dist) {
+            min_dist = curr_dist;
+            neutron->_surface = *iter;
+        }
+    }
+
+    return min_dist;
+}
+
+
+/**
+ * @brief Moves a neutron to its next collision or surface crossing within 
+ *        its region.
+ * @details The neutron is tracked in the compiled geometry, or is collided
+ *          by its region if the geometry is not HETEROGENEOUS. If the 
+ *          geometry is filled by a lattice, the lattice's boundary condition
+ *          is applied if the neutron crossed an edge of the lattice.
+ * @param neutron the neutron of interest
+ */
+void Geometry::surfaceTrackNeutron(neutron* neutron) {
+
+    /* Neutrons in INFINITE_HOMOGENEOUS and HOMOGENEOUS_EQUIVALENCE 
+     * geometries are collided by their region */
+    if (_compiled == NULL) {
+        neutron->_region->collideNeutron(neutron);
+        return;
+    }
+
+    _compiled->trackNeutron(neutron);
+
+    if (_lattice != NULL && neutron->_alive)
+        _lattice->applyBoundaryCondition(neutron);
+}
+
+
+/**
+ * @brief Moves a neutron to its next collision with Woodcock delta tracking.
+ * @details Flights are sampled from the majorant cross-section at the 
+ *          neutron's energy until a collision is accepted as real, at which
+ *          point the neutron is collided in the region containing it. Flights
+ *          which reach the boundary of the geometry are stopped at the 
+ *          boundary to reflect or kill the neutron. If the ratio of the total
+ *          cross-section in the neutron's region to the majorant is below 
+ *          the minimum ratio, many of the collisions would be rejected and
+ *          the neutron is instead surface tracked by its region. If the 
+ *          geometry is filled by a lattice, flights are sampled in global
+ *          coordinates and the region at each collision point is found in
+ *          the local coordinates of its lattice cell.
+ * @param neutron the neutron of interest
+ */
+void Geometry::deltaTrackNeutron(neutron* neutron) {
+
+    Region* region = neutron->_region;
+    float energy = neutron->_energy;
+    float majorant = getMajorant(energy);
+
+    if (region->getTotalMacroXS(energy) < _delta_tracking_ratio * majorant) {
+        surfaceTrackNeutron(neutron);
+        return;
+    }
+
+    if (_lattice != NULL)
+        _lattice->toGlobalCoords(neutron);
+
+    Surface* reflected = NULL;
+
+    while (true) {
+
+        float distance = -log(float(rand()) / RAND_MAX) / majorant;
+        float boundary_distance = computeBoundaryDistance(neutron, reflected);
+        reflected = NULL;
+
+        /* The flight reached the boundary of the geometry */
+        if (boundary_distance <= distance) {
+
+            neutron->_path_length = boundary_distance;
+            neutron->_x += boundary_distance * neutron->_u;
+            neutron->_y += boundary_distance * neutron->_v;
+            neutron->_z += boundary_distance * neutron->_w;
+
+            /* A leaked neutron is left on the boundary in the local 
+             * coordinates of its lattice cell */
+            if (neutron->_surface->getBoundaryType() == VACUUM) {
+                neutron->_alive = false;
+
+                if (_lattice != NULL)
+                    _lattice->toLocalCoords(neutron);
+
+                return;
+            }
+
+            neutron->_surface->reflectNeutron(neutron);
+            reflected = neutron->_surface;
+            continue;
+        }
+
+        neutron->_x += distance * neutron->_u;
+        neutron->_y += distance * neutron->_v;
+        neutron->_z += distance * neutron->_w;
+
+        if (_lattice != NULL)
+            _lattice->toLocalCoords(neutron);
+
+        BoundedRegion* next = findRegion(neutron);
+
+        if (next == NULL) {
+            log_printf(WARNING, "Unable to find the region containing neutron"
+                       " at (x,y,z) = (%f,%f,%f)", neutron->_x, neutron->_y,
+                       neutron->_z);
+            neutron->_alive = false;
+            return;
+        }
+
+        /* Accept the collision as real with the probability of the ratio of 
+         * the region's total cross-section to the majorant. The material 
+         * sets the neutron's path length to the region's mean free path, 
+         * such that the collision is tallied as for surface tracking */
+        float total_xs = next->getTotalMacroXS(energy);
+
+        if (float(rand()) / RAND_MAX * majorant < total_xs) {
+            neutron->_region = next;
+            neutron->_region_index = _compiled->getRegionIndex(next);
+            neutron->_halfspace_index = -1;
+            neutron->_temperature = next->getTemperature();
+            next->getMaterial()->collideNeutron(neutron);
+            return;
+        }
+
+        if (_lattice != NULL)
+            _lattice->toGlobalCoords(neutron);
+    }
+}
+
+
+/**
+ * @brief Estimates the volumes of the regions in a HETEROGENEOUS geometry.
+ * @details The volume of each region whose volume has not been set, or was
+ *          estimated previously, is estimated from the fraction of points
+ *          in the bounding box of the geometry which it contains. The points
+ *          are those of the Halton sequence in bases 2 and 3, which fill the
+ *          box more evenly than random points, and are located in parallel
+ *          by the uniform grid or lattice. The sequence is shifted modulo 
+ *          the box by each of ten fixed offsets, such that the spread of 
+ *          the ten independent estimates of each volume gives its standard 
+ *          deviation. The volumes are estimated when a simulation is run 
+ *          and are kept until the regions or lattice of the geometry change.
+ *          A user may estimate the volumes with more points from within 
+ *          Python as follows:
+ *
+ * @code
+ *          geometry.computeVolumes(10000000)
+ *          print region.getVolume(), region.getVolumeUncertainty()
+ * @endcode
+ *
+ * @param num_points the number of points sampled in the geometry
+ */
+void Geometry::computeVolumes(int num_points) {
+
+    if (_spatial_type != HETEROGENEOUS) {
+        log_printf(ERROR, "Unable to compute the volumes of the regions in "
+                   "geometry %s since it is not a HETEROGENEOUS type "
+                   "geometry", _geometry_name);
+        return;
+    }
+
+    if (_lattice != NULL && _regions.empty()) {
+        if (!initializeLattice())
+            return;
+    }
+    else if (_lattice == NULL && _grid_nx == 0)
+        initializeRegionGrid();
+
+    _volumes_computed = true;
+
+    /* Index the regions whose volumes are estimated by their uids */
+    std::vector<BoundedRegion*> regions;
+    std::vector<int> indices;
+
+    std::vector<BoundedRegion*>::iterator iter;
+    for (iter = _regions.begin(); iter != _regions.end(); ++iter) {
+
+        if ((*iter)->isVolumeSet() && (*iter)->getVolumeUncertainty() == 0.0)
+            continue;
+
+        int uid = (*iter)->getUid();
+
+        if (uid >= int(indices.size()))
+            indices.resize(uid+1, -1);
+
+        indices[uid] = regions.size();
+        regions.push_back(*iter);
+    }
+
+    if (regions.empty())
+        return;
+
+    /* Find the bounding box of the lattice or the uniform grid */
+    float x_min, y_min, width_x, width_y;
+
+    if (_lattice != NULL) {
+        x_min = _lattice->getCellCenterX(0) - _lattice->getWidthX() / 2.0;
+        y_min = _lattice->getCellCenterY(0) - _lattice->getWidthY() / 2.0;
+        width_x = _lattice->getNumX() * _lattice->getWidthX();
+        width_y = _lattice->getNumY() * _lattice->getWidthY();
+    }
+    else if (_grid_nx > 0) {
+        x_min = _grid_x_min;
+        y_min = _grid_y_min;
+        width_x = _grid_nx * _grid_dx;
+        width_y = _grid_ny * _grid_dy;
+    }
+    else {
+        log_printf(ERROR, "Unable to compute the volumes of the regions in "
+                   "geometry %s since the regions are not bounded",
+                   _geometry_name);
+        return;
+    }
+
+    /* The irrational offsets between the shifted sequences */
+    const int num_shifts = 10;
+    const double shift_x = 0.7548776662466927;
+    const double shift_y = 0.5698402909980532;
+
+    int num_regions = regions.size();
+    int num_points_per_shift = std::max(1, num_points / num_shifts);
+    std::vector<long> counts(num_shifts * num_regions, 0);
+
+    omp_set_num_threads(_num_threads);
+
+    #pragma omp parallel
+    {
+        std::vector<long> thread_counts(num_shifts * num_regions, 0);
+
+        #pragma omp for
+        for (int i=0; i < num_points_per_shift; i++) {
+
+            double u = computeRadicalInverse(i+1, 2);
+            double v = computeRadicalInverse(i+1, 3);
+
+            for (int k=0; k < num_shifts; k++) {
+
+                double su = u + k * shift_x;
+                double sv = v + k * shift_y;
+                su -= floor(su);
+                sv -= floor(sv);
+
+                BoundedRegion* region = findRegion(x_min + su * width_x,
+                                                   y_min + sv * width_y, 0.0);
+
+                if (region == NULL)
+                    continue;
+
+                int uid = region->getUid();
+
+                if (uid < int(indices.size()) && indices[uid] >= 0)
+                    thread_counts[k * num_regions + indices[uid]]++;
+            }
+        }
+
+        #pragma omp critical
+        {
+            for (int j=0; j < num_shifts * num_regions; j++)
+                counts[j] += thread_counts[j];
+        }
+    }
+
+    /* Estimate each volume and its standard deviation from the shifts */
+    double area = double(width_x) * double(width_y);
+
+    for (int r=0; r < num_regions; r++) {
+
+        double mean = 0.0;
+        double variance = 0.0;
+
+        for (int k=0; k < num_shifts; k++)
+            mean += counts[k * num_regions + r];
+
+        mean /= num_shifts;
+
+        for (int k=0; k < num_shifts; k++) {
+            double deviation = counts[k * num_regions + r] - mean;
+            variance += deviation * deviation;
+        }
+
+        variance /= num_shifts * (num_shifts - 1);
+
+        if (mean == 0.0) {
+            log_printf(WARNING, "Unable to estimate the volume of region %s "
+                       "since it does not contain any of the %d points "
+                       "sampled in geometry %s", regions[r]->getName(),
+                       num_points_per_shift * num_shifts, _geometry_name);
+            continue;
+        }
+
+        float volume = area * mean / num_points_per_shift;
+        float uncertainty = area * sqrt(variance) / num_points_per_shift;
+
+        /* Remove the previous estimate from the volume of the material */
+        Material* material = regions[r]->getMaterial();
+
+        if (regions[r]->isVolumeSet() && material != NULL)
+            material->incrementVolume(-regions[r]->getVolume());
+
+        regions[r]->setVolume(volume, uncertainty);
+
+        log_printf(INFO, "Estimated the volume of region %s to be %f +/- %f",
+                   regions[r]->getName(), volume, uncertainty);
+    }
+
+    log_printf(NORMAL, "Estimated the volumes of %d regions in geometry %s "
+               "with %d points", num_regions, _geometry_name, 
+               num_points_per_shift * num_shifts);
+}
+
+
+/**
+ * @brief Records the tracks of source neutrons transported through a 
+ *        HETEROGENEOUS geometry.
+ * @details Each neutron is transported by the same kernel as in a 
+ *          simulation, but is not tallied, and the neutrons are transported
+ *          in sequence. A point is recorded at the source site, at each 
+ *          collision and surface crossing of the neutron subject to the 
+ *          recorder's decimation, and where the neutron is absorbed or 
+ *          leaks. The points are recorded in global coordinates if the 
+ *          geometry is filled by a lattice. Recording stops once the 
+ *          recorder is full, which truncates the last track. Since the 
+ *          points are recorded outside of the kernel, recording does not 
+ *          slow down a simulation.
+ * @param recorder the track recorder
+ * @param num_neutrons the number of neutrons to transport
+ */
+void Geometry::recordTracks(TrackRecorder* recorder, int num_neutrons) {
+
+    if (_spatial_type != HETEROGENEOUS) {
+        log_printf(ERROR, "Unable to record neutron tracks in geometry %s "
+                   "since it is not a HETEROGENEOUS type geometry",
+                   _geometry_name);
+        return;
+    }
+
+    if (_regions.empty() && _lattice == NULL) {
+        log_printf(ERROR, "Unable to record neutron tracks in geometry %s "
+                   "since it does not contain any BOUNDED type regions",
+                   _geometry_name);
+        return;
+    }
+
+    if (!initializeRegions())
+        return;
+
+    neutron curr;
+    int decimation = recorder->getDecimation();
+    int i;
+
+    for (i=0; i < num_neutrons && !recorder->isFull(); i++) {
+
+        initializeSourceNeutron(&curr);
+        recordTrackPoint(recorder, &curr, SOURCE);
+
+        for (int j=1; curr._alive == true; j++) {
+
+            /* The neutron is only collided if it does not cross a surface */
+            curr._collided = false;
+            transportNeutron(&curr);
+
+            if (!curr._alive)
+                recordTrackPoint(recorder, &curr, 
+                                 curr._collided ? ABSORPTION : LEAKAGE);
+            else if (j % decimation == 0)
+                recordTrackPoint(recorder, &curr, 
+                                 curr._collided ? COLLISION : CROSSING);
+        }
+
+        recorder->endTrack();
+    }
+
+    if (i < num_neutrons)
+        log_printf(WARNING, "Unable to record the tracks of %d of %d "
+                   "neutrons since the recorder was filled by %d points",
+                   num_neutrons - i, num_neutrons, recorder->getMaxPoints());
+}
+
+
+/**
+ * @brief Records a point along the track of a neutron.
+ * @param recorder the track recorder
+ * @param neutron the neutron of interest
+ * @param event the event at the neutron's location
+ */
+void Geometry::recordTrackPoint(TrackRecorder* recorder, neutron* neutron,
+                                trackEvent event) {
+
+    float x = neutron->_x;
+    float y = neutron->_y;
+
+    if (_lattice != NULL && neutron->_cell >= 0) {
+        x += _lattice->getCellCenterX(neutron->_cell);
+        y += _lattice->getCellCenterY(neutron->_cell);
+    }
+
+    int region_uid = (neutron->_region != NULL) ? 
+                      neutron->_region->getUid() : 0;
+
+    recorder->recordPoint(x, y, neutron->_z, neutron->_energy, region_uid,
+                          event);
+}
+
+
 /**
  * @brief The primary Monte Carlo kernel for a PINSPEC simulation.
  * @details This method executes an appropriate Monte Carlo kernel depending
@@ -505,7 +1317,8 @@ void Geometry::runMonteCarloSimulation() {
             log_printf(ERROR, "Unable to run a HOMOGENEOUS_EQUIVALENCE type "
 		       "simulation since the dancoff factor has not yet "
 		       "been set for the geometry");
-    if (_spatial_type == HETEROGENEOUS && _regions.size() == 0)
+    if (_spatial_type == HETEROGENEOUS && _regions.size() == 0 && 
+        _lattice == NULL)
         log_printf(ERROR, "Unable to run a HETEROGENEOUS type simulation since "
                    " the geometry does not contain any BOUNDED type regions");
 
@@ -523,11 +1336,15 @@ void Geometry::runMonteCarloSimulation() {
 
     if (_spatial_type == INFINITE_HOMOGENEOUS) {
         _infinite_medium->setBucklingSquared(_buckling_squared);
+        _infinite_medium->getMaterial()->buildXSTables();
     }
     else if (_spatial_type == HOMOGENEOUS_EQUIVALENCE) {
         _fuel->setBucklingSquared(_buckling_squared);
 	_moderator->setBucklingSquared(_buckling_squared);
 
+        _fuel->getMaterial()->buildXSTables();
+        _moderator->getMaterial()->buildXSTables();
+
         _fuel->setOtherRegion(_moderator);
         _moderator->setOtherRegion(_fuel);
 
@@ -539,11 +1356,8 @@ void Geometry::runMonteCarloSimulation() {
 
         initializeProbModFuelRatios();
     }
-    else {
-        std::vector<BoundedRegion*>::iterator iter;
-        for (iter = _regions.begin(); iter != _regions.end(); ++iter)
-              (*iter)->setBucklingSquared(_buckling_squared);
-    }
+    else if (!initializeRegions())
+        return;
 
     tally_bank->initializeBatchTallies(_num_batches);
 
@@ -583,9 +1397,16 @@ void Geometry::runMonteCarloSimulation() {
 		     * the region, material, and isotope classes filling
                      * the geometry */
                      while (curr._alive == true) {
-                         findContainingRegion(&curr);
-                         curr._region->collideNeutron(&curr);
-                         tally_bank->tally(&curr);
+                         curr._collided = false;
+                         transportNeutron(&curr);
+
+                         /* Neutrons in HETEROGENEOUS geometries are only 
+                          * tallied at collisions since the tallies are 
+                          * collision estimators */
+                         if (_compiled == NULL)
+                             tally_bank->tally(&curr);
+                         else if (curr._collided)
+                             _compiled->tally(&curr);
                     }
                 }
 	    }
@@ -681,22 +1502,534 @@ void Geometry::initializeProbModFuelRatios() {
 }
 
 
+/**
+ * @brief Finds the regions in which to sample source sites for a 
+ *        HETEROGENEOUS geometry.
+ * @details The source regions are the BOUNDED type regions with a non-zero
+ *          thermal fission cross-section. The bounding box of each region in
+ *          the xy-plane is clipped to the source sampling sphere. A source 
+ *          site is sampled by picking a box with probability proportional 
+ *          to its area and a point uniformly within the box, which is 
+ *          accepted if it is within the region and the sphere. Since the 
+ *          regions do not overlap, the accepted sites are uniformly 
+ *          distributed within the fissionable regions, and the number of 
+ *          attempts is the ratio of the box areas to the region areas rather
+ *          than of the sphere to the fissionable regions. If the geometry 
+ *          is filled by a lattice, each fissionable region is a source 
+ *          region in each of the lattice cells filled by its universe.
+ */
+void Geometry::initializeSourceRegions() {
+
+    float radius = _source_sampling_radius;
+    float x_min, x_max, y_min, y_max;
+    float area = 0.0;
+
+    _source_regions.clear();
+    _source_bounds.clear();
+    _source_cdf.clear();
+    _source_cells.clear();
+    _source_regions_found = true;
+
+    int num_cells = (_lattice != NULL) ? _lattice->getNumCells() : 1;
+
+    for (int cell=0; cell < num_cells; cell++) {
+
+        std::vector<BoundedRegion*>* regions = &_regions;
+        float x = 0.0;
+        float y = 0.0;
+
+        if (_lattice != NULL) {
+
+            if (_lattice->getUniverse(cell) == NULL)
+                continue;
+
+            regions = &_lattice->getUniverse(cell)->getRegions();
+            x = _lattice->getCellCenterX(cell);
+            y = _lattice->getCellCenterY(cell);
+        }
+
+        std::vector<BoundedRegion*>::iterator iter;
+        for (iter = regions->begin(); iter != regions->end(); ++iter) {
+
+            if ((*iter)->getMaterial() == NULL || 
+                (*iter)->getFissionMacroXS(0.0253f) <= 0.0)
+                continue;
+
+            (*iter)->getBoundingBox(&x_min, &x_max, &y_min, &y_max);
+
+            x_min = std::max(x_min + x, -radius);
+            x_max = std::min(x_max + x, radius);
+            y_min = std::max(y_min + y, -radius);
+            y_max = std::min(y_max + y, radius);
+
+            if (x_max <= x_min || y_max <= y_min)
+                continue;
+
+            area += (x_max - x_min) * (y_max - y_min);
+
+            _source_regions.push_back(*iter);
+            _source_bounds.push_back(x_min);
+            _source_bounds.push_back(x_max);
+            _source_bounds.push_back(y_min);
+            _source_bounds.push_back(y_max);
+            _source_cdf.push_back(area);
+            _source_cells.push_back((_lattice != NULL) ? cell : -1);
+        }
+    }
+
+    log_printf(INFO, "Sampling source sites in %d fissionable regions",
+               int(_source_regions.size()));
+}
+
+
+/**
+ * @brief Prepares the regions of a HETEROGENEOUS geometry for neutrons to be
+ *        transported through them.
+ * @details The regions are found from the lattice, their cross-section 
+ *          tables and bounding surfaces are prepared, the uniform grid, 
+ *          neighbors, source regions and majorant are built, the volumes of
+ *          the regions are estimated if they have not been, and the 
+ *          geometry is compiled.
+ * @return true if the regions were prepared, or false if the lattice 
+ *         filling the geometry is invalid or a region has no material
+ */
+bool Geometry::initializeRegions() {
+
+    if (_lattice != NULL && !initializeLattice())
+        return false;
+
+    std::vector<BoundedRegion*>::iterator iter;
+    for (iter = _regions.begin(); iter != _regions.end(); ++iter) {
+        if ((*iter)->getMaterial() == NULL) {
+            log_printf(ERROR, "Unable to run a HETEROGENEOUS type simulation "
+                       "since region %s does not contain a material", 
+                       (*iter)->getName());
+            return false;
+        }
+    }
+
+    for (iter = _regions.begin(); iter != _regions.end(); ++iter) {
+          (*iter)->setBucklingSquared(_buckling_squared);
+
+          (*iter)->getMaterial()->buildXSTables();
+
+          (*iter)->groupBoundingSurfaces();
+    }
+
+    if (_lattice == NULL)
+        initializeRegionGrid();
+
+    initializeRegionNeighbors();
+    initializeSourceRegions();
+    initializeMajorant();
+
+    if (!_volumes_computed)
+        computeVolumes();
+
+    delete _compiled;
+    _compiled = new CompiledGeometry(_regions);
+
+    return true;
+}
+
+
+/**
+ * @brief Builds a uniform grid over the regions in the xy-plane to find the
+ *        region containing a neutron.
+ * @details The grid spans the union of the finite bounding boxes of the 
+ *          regions, and sides of a bounding box which are unbounded are
+ *          clipped to the grid. The grid has roughly four cells per region
+ *          with the same aspect ratio as the grid, and each cell stores 
+ *          the regions whose bounding boxes overlap it in the order they 
+ *          were added to the geometry. The bounding boxes are expanded by
+ *          a small tolerance since a neutron on a surface is contained by
+ *          the regions on either side of it. Neutrons outside of the grid 
+ *          test each of the regions.
+ */
+void Geometry::initializeRegionGrid() {
+
+    /* The tolerance for bounding boxes (cm), which exceeds the distance
+     * for which a neutron on a surface is contained by a region */
+    float tolerance = 1E-3;
+
+    /* Sides of bounding boxes beyond this distance (cm) are unbounded, which
+     * is tested by comparison since infinities are not supported with
+     * -ffast-math */
+    float unbounded = 1E30;
+
+    int num_regions = _regions.size();
+    std::vector<float> bounds(4 * num_regions);
+    float x_min = unbounded;
+    float y_min = unbounded;
+    float x_max = -unbounded;
+    float y_max = -unbounded;
+
+    _grid_nx = 0;
+    _grid_ny = 0;
+    _grid_offsets.clear();
+    _grid_regions.clear();
+
+    /* Find the bounding box of each region and the extent of the grid */
+    for (int r=0; r < num_regions; r++) {
+
+        float* box = &bounds[4*r];
+        _regions[r]->getBoundingBox(&box[0], &box[1], &box[2], &box[3]);
+
+        box[0] -= tolerance;
+        box[1] += tolerance;
+        box[2] -= tolerance;
+        box[3] += tolerance;
+
+        for (int i=0; i < 4; i++) {
+
+            box[i] = std::max(-unbounded, std::min(unbounded, box[i]));
+
+            if (fabs(box[i]) >= unbounded)
+                continue;
+
+            if (i < 2) {
+                x_min = std::min(x_min, box[i]);
+                x_max = std::max(x_max, box[i]);
+            }
+            else {
+                y_min = std::min(y_min, box[i]);
+                y_max = std::max(y_max, box[i]);
+            }
+        }
+    }
+
+    /* Search the regions linearly if the regions are not bounded */
+    if (!(x_max > x_min) || !(y_max > y_min))
+        return;
+
+    int num_cells = std::max(1, 4 * num_regions);
+    float aspect_ratio = (x_max - x_min) / (y_max - y_min);
+    int nx = std::max(1, int(sqrt(num_cells * aspect_ratio)));
+    int ny = std::max(1, num_cells / nx);
+    float dx = (x_max - x_min) / nx;
+    float dy = (y_max - y_min) / ny;
+
+    /* Find the range of grid cells overlapped by each region */
+    std::vector<int> ranges(4 * num_regions);
+
+    for (int r=0; r < num_regions; r++) {
+
+        /* Clip the bounding box to the grid before converting to cells */
+        float* box = &bounds[4*r];
+        box[0] = std::max(box[0], x_min);
+        box[1] = std::min(box[1], x_max);
+        box[2] = std::max(box[2], y_min);
+        box[3] = std::min(box[3], y_max);
+
+        ranges[4*r] = std::max(0, int(floor((box[0] - x_min) / dx)));
+        ranges[4*r+1] = std::min(nx - 1, int(floor((box[1] - x_min) / dx)));
+        ranges[4*r+2] = std::max(0, int(floor((box[2] - y_min) / dy)));
+        ranges[4*r+3] = std::min(ny - 1, int(floor((box[3] - y_min) / dy)));
+    }
+
+    /* Count the regions in each cell and then fill in the regions */
+    _grid_offsets.assign(nx * ny + 1, 0);
+
+    for (int r=0; r < num_regions; r++) {
+        for (int j=ranges[4*r+2]; j <= ranges[4*r+3]; j++) {
+            for (int i=ranges[4*r]; i <= ranges[4*r+1]; i++)
+                _grid_offsets[j * nx + i + 1]++;
+        }
+    }
+
+    for (int c=0; c < nx * ny; c++)
+        _grid_offsets[c+1] += _grid_offsets[c];
+
+    std::vector<int> next(_grid_offsets.begin(), _grid_offsets.end() - 1);
+    _grid_regions.resize(_grid_offsets.back());
+
+    for (int r=0; r < num_regions; r++) {
+        for (int j=ranges[4*r+2]; j <= ranges[4*r+3]; j++) {
+            for (int i=ranges[4*r]; i <= ranges[4*r+1]; i++)
+                _grid_regions[next[j * nx + i]++] = _regions[r];
+        }
+    }
+
+    _grid_x_min = x_min;
+    _grid_y_min = y_min;
+    _grid_dx = dx;
+    _grid_dy = dy;
+    _grid_nx = nx;
+    _grid_ny = ny;
+
+    log_printf(INFO, "Built a %d x %d grid with %d region references to "
+               "find the regions in the geometry", nx, ny,
+               int(_grid_regions.size()));
+}
+
+
+/**
+ * @brief Finds the regions on the other side of each region's bounding
+ *        surfaces.
+ * @details The neighbors of a region across one of its bounding surfaces 
+ *          are the regions bounded by the opposite halfspace of the same
+ *          surface, in the order they were added to the geometry. Regions
+ *          which are across a surface but not bounded by it are not 
+ *          neighbors, and neutrons which enter them are found by searching
+ *          all of the regions. If the geometry is filled by a lattice, the
+ *          neighbors of a region are only found within its universe.
+ */
+void Geometry::initializeRegionNeighbors() {
+
+    std::vector<BoundedRegion*>::iterator iter;
+    for (iter = _regions.begin(); iter != _regions.end(); ++iter)
+        (*iter)->clearNeighbors();
+
+    int num_links = 0;
+
+    if (_lattice == NULL)
+        num_links = linkRegionNeighbors(_regions);
+    else {
+        std::vector<Universe*> universes = _lattice->getUniqueUniverses();
+        for (int i=0; i < int(universes.size()); i++)
+            num_links += linkRegionNeighbors(universes[i]->getRegions());
+    }
+
+    _region_neighbors_found = true;
+
+    log_printf(INFO, "Found %d neighbors across the surfaces of %d regions",
+               num_links, int(_regions.size()));
+}
+
+
+/**
+ * @brief Links each of a set of regions to the regions in the set bounded
+ *        by the opposite halfspaces of its bounding surfaces.
+ * @param regions the regions to link
+ * @return the number of neighbors linked
+ */
+int Geometry::linkRegionNeighbors(std::vector<BoundedRegion*>& regions) {
+
+    std::map<Surface*, std::vector<BoundedRegion*> > positive;
+    std::map<Surface*, std::vector<BoundedRegion*> > negative;
+    std::vector<BoundedRegion*>::iterator iter;
+    std::vector<BoundedRegion*>::iterator neighbor;
+
+    /* Find the regions bounded by each halfspace of each surface */
+    for (iter = regions.begin(); iter != regions.end(); ++iter) {
+
+        for (int i=0; i < (*iter)->getNumBoundingSurfaces(); i++) {
+            Surface* surface = (*iter)->getBoundingSurface(i);
+            if ((*iter)->getBoundingHalfspace(i) > 0)
+                positive[surface].push_back(*iter);
+            else
+                negative[surface].push_back(*iter);
+        }
+    }
+
+    /* Link each region to the regions bounded by the opposite halfspaces */
+    int num_links = 0;
+
+    for (iter = regions.begin(); iter != regions.end(); ++iter) {
+
+        for (int i=0; i < (*iter)->getNumBoundingSurfaces(); i++) {
+
+            Surface* surface = (*iter)->getBoundingSurface(i);
+            std::vector<BoundedRegion*>& others = 
+                ((*iter)->getBoundingHalfspace(i) > 0) ? negative[surface] 
+                                                       : positive[surface];
+
+            for (neighbor = others.begin(); neighbor != others.end(); 
+                 ++neighbor) {
+                (*iter)->addNeighbor(surface, *neighbor);
+                num_links++;
+            }
+        }
+    }
+
+    return num_links;
+}
+
+
+/**
+ * @brief Finds the regions of a geometry filled by a lattice.
+ * @details The regions are those of each of the universes in the lattice.
+ *          Since a neutron is only looked for in the universe of its lattice
+ *          cell, each cell must be filled and the regions of each universe
+ *          must lie within a lattice cell in its local coordinates. The 
+ *          surfaces bounding the regions must be INTERFACE type surfaces 
+ *          since the boundary condition is applied by the lattice. The 
+ *          geometry is left without regions if the lattice is invalid.
+ * @return true if the lattice is valid, otherwise false
+ */
+bool Geometry::initializeLattice() {
+
+    /* The tolerance for bounding boxes (cm) */
+    float tolerance = 1E-3;
+    float half_width_x = _lattice->getWidthX() / 2.0 + tolerance;
+    float half_width_y = _lattice->getWidthY() / 2.0 + tolerance;
+    float x_min, x_max, y_min, y_max;
+    bool valid = true;
+
+    _regions = _lattice->getRegions();
+
+    if (_regions.empty()) {
+        log_printf(ERROR, "Unable to run a HETEROGENEOUS type simulation since "
+                   "lattice %s does not contain any BOUNDED type regions",
+                   _lattice->getName());
+        return false;
+    }
+
+    for (int cell=0; cell < _lattice->getNumCells(); cell++) {
+        if (_lattice->getUniverse(cell) == NULL) {
+            log_printf(ERROR, "Unable to run a HETEROGENEOUS type simulation "
+                       "since cell %d of lattice %s is not filled by a "
+                       "universe", cell, _lattice->getName());
+            _regions.clear();
+            return false;
+        }
+    }
+
+    std::vector<BoundedRegion*>::iterator iter;
+    for (iter = _regions.begin(); iter != _regions.end(); ++iter) {
+
+        (*iter)->getBoundingBox(&x_min, &x_max, &y_min, &y_max);
+
+        if (x_min < -half_width_x || x_max > half_width_x || 
+            y_min < -half_width_y || y_max > half_width_y) {
+            log_printf(ERROR, "Unable to run a HETEROGENEOUS type simulation "
+                       "since region %s extends beyond the cells of lattice "
+                       "%s", (*iter)->getName(), _lattice->getName());
+            valid = false;
+        }
+
+        for (int i=0; i < (*iter)->getNumBoundingSurfaces(); i++) {
+            if ((*iter)->getBoundingSurface(i)->getBoundaryType() != INTERFACE){
+                log_printf(ERROR, "Unable to run a HETEROGENEOUS type "
+                           "simulation since region %s in lattice %s is "
+                           "bounded by a surface which is not an INTERFACE "
+                           "type surface", (*iter)->getName(), 
+                           _lattice->getName());
+                valid = false;
+            }
+        }
+    }
+
+    if (!valid) {
+        _regions.clear();
+        return false;
+    }
+
+    log_printf(INFO, "Filled the geometry with a %d x %d lattice of %d "
+               "regions", _lattice->getNumX(), _lattice->getNumY(),
+               int(_regions.size()));
+
+    return true;
+}
+
+
+/**
+ * @brief Builds the majorant cross-section for delta tracking.
+ * @details The majorant at each energy in the uniform lethargy grid is the 
+ *          largest total cross-section of all of the materials at that 
+ *          energy. Since each material's cross-sections are interpolated
+ *          linearly between the grid energies, the majorant interpolated in
+ *          the same way bounds each material at all energies within the 
+ *          grid. Neutrons are surface tracked if delta tracking has not been
+ *          set, if any material does not have cross-section tables on a 
+ *          shared grid, or if the geometry has no REFLECTIVE or VACUUM
+ *          boundary surfaces.
+ */
+void Geometry::initializeMajorant() {
+
+    _majorant_material = NULL;
+    _majorant.clear();
+    _boundary_surfaces.clear();
+
+    if (!_delta_tracking)
+        return;
+
+    std::set<Material*> materials;
+    std::set<Surface*> boundary_surfaces;
+
+    /* The boundary of a geometry filled by a lattice is the lattice's */
+    if (_lattice != NULL) {
+        for (int i=0; i < 4; i++)
+            _boundary_surfaces.push_back(_lattice->getBoundarySurface(i));
+    }
+
+    std::vector<BoundedRegion*>::iterator iter;
+    for (iter = _regions.begin(); iter != _regions.end(); ++iter) {
+
+        Material* material = (*iter)->getMaterial();
+
+        if (material != NULL)
+            materials.insert(material);
+
+        if (_lattice != NULL)
+            continue;
+
+        for (int i=0; i < (*iter)->getNumBoundingSurfaces(); i++) {
+            Surface* surface = (*iter)->getBoundingSurface(i);
+            if (surface->getBoundaryType() != INTERFACE && 
+                boundary_surfaces.insert(surface).second)
+                _boundary_surfaces.push_back(surface);
+        }
+    }
+
+    if (materials.empty() || _boundary_surfaces.empty()) {
+        log_printf(WARNING, "Unable to delta track neutrons since the "
+                   "geometry has no materials or no REFLECTIVE or VACUUM "
+                   "boundary surfaces");
+        return;
+    }
+
+    Material* first = *materials.begin();
+    std::set<Material*>::iterator mat_iter;
+
+    for (mat_iter = materials.begin(); mat_iter != materials.end(); ++mat_iter){
+        if (!(*mat_iter)->sharesXSTableGrid(first)) {
+            log_printf(WARNING, "Unable to delta track neutrons since the "
+                       "cross-sections for material %s are not tabulated on "
+                       "a shared uniform lethargy grid", 
+                       (*mat_iter)->getMaterialName());
+            return;
+        }
+    }
+
+    /* The majorant is padded with a copy of its last grid energy like the 
+     * materials' cross-section tables */
+    int num_energies = first->getNumXSEnergies((char*)"total");
+    _majorant.resize(num_energies + 1, 0.0);
+
+    for (mat_iter = materials.begin(); mat_iter != materials.end(); ++mat_iter){
+        for (int i=0; i < num_energies; i++)
+            _majorant[i] = std::max(_majorant[i], 
+                                    (*mat_iter)->getTotalMacroXS(i));
+    }
+
+    _majorant[num_energies] = _majorant[num_energies-1];
+    _majorant_material = first;
+
+    log_printf(INFO, "Built the majorant cross-section for delta tracking "
+               "from %d materials", int(materials.size()));
+}
+
+
 /**
  * @brief Initializes a new source neutron within the geometry.
  * @details A source neutron initialized within the geometry will 
- *          have an energy (eV) from a Watt spectrum, an _alive attribute
- *          set to true, a _collided attribute set to false, and its
- *          _region pointer set to this region. The _material and _isotope 
- *          attributes will be set to NULL. For HETEROGENEOUS geometries, 
- *          this method uses rejection sampling to initialize the neutrons 
- *          location to a source site within the geometry with a non-zero 
- *          fission cross-section. An isotropic (in lab) direction vector is 
- *          sampled for the neutron's trajectory in 3D.
+ *          have an energy (eV) sampled from the geometry's source, an 
+ *          _alive attribute set to true, a _collided attribute set to false,
+ *          and its _region pointer set to this region. The _material and 
+ *          _isotope attributes will be set to NULL. For HETEROGENEOUS 
+ *          geometries, this method samples the neutron's location uniformly
+ *          within the regions with a non-zero fission cross-section (and 
+ *          within the source sampling radius) from the bounding boxes of the
+ *          regions. An isotropic (in lab) unit direction vector is sampled 
+ *          for the neutron's trajectory in 3D. If the geometry is filled by
+ *          a lattice, the neutron's location is in the local coordinates of
+ *          its lattice cell.
  * @param neutron the neutron of interest
  */
 void Geometry::initializeSourceNeutron(neutron* neutron) {
 
-    neutron->_energy = _fissioner->emitNeutroneV();
+    neutron->_energy = _source->sampleEnergy();
     neutron->_old_energy = neutron->_energy;
     neutron->_collided = false;
     //    neutron->_total_xs = 0.0;
@@ -705,6 +2038,9 @@ void Geometry::initializeSourceNeutron(neutron* neutron) {
     neutron->_material = NULL;
     neutron->_isotope = NULL;
     neutron->_surface = NULL;
+    neutron->_cell = -1;
+    neutron->_region_index = -1;
+    neutron->_halfspace_index = -1;
 
     if (_spatial_type == INFINITE_HOMOGENEOUS) {
         neutron->_region = _infinite_medium;
@@ -716,46 +2052,75 @@ void Geometry::initializeSourceNeutron(neutron* neutron) {
         neutron->_surface = NULL;
     }
 
-    /* Use rejection sampling to sample a source site within a HETEROGENEOUS 
-     * geometry with a non-zero fission cross-section */
+    /* Sample a source site within a HETEROGENEOUS geometry with a non-zero 
+     * fission cross-section */
     else {
+
+        if (!_source_regions_found)
+            initializeSourceRegions();
+
+        float radius = _source_sampling_radius;
+        int num_regions = _source_regions.size();
         int i;
 
-        for (i=0; i < 1000; i++) {
-
-	    /* Uniformly sample within a sphere */
-            /* Azimuthal angle in xy-plane */
-	    float phi = (float(rand()) / RAND_MAX) * 2.0 * M_PI;
-
-            /* Polar angle with respect to z-axis */
-            float cos_theta = (float(rand()) / RAND_MAX) * 2.0 - 1.0; 
-            float theta = acos(cos_theta);
-
-            /* Radius from sphere center */
-            float u = float(rand()) / RAND_MAX; 
-            float radius = _source_sampling_radius * pow(u, (1./3.));
-
-            /* Spherical to cartesian coordinate conversion */
-            neutron->_x = radius * sin(theta) * cos(phi);
-            neutron->_y = radius * sin(theta) * sin(phi);
-            neutron->_z = radius * cos(theta);
-     
-            /* If we successfully found a source site within the geometry with
-  	     * a non-zero thermal fission cross-section, break the loop */
-            if (contains(neutron) && 
-	        neutron->_region->getFissionMacroXS(0.0253f) > 0.0)
-	            break;
+        for (i=0; i < 1000 && num_regions > 0; i++) {
+
+            /* Sample a region with probability proportional to the area of 
+             * its bounding box */
+            float test = float(rand()) / RAND_MAX * _source_cdf.back();
+            int index = std::upper_bound(_source_cdf.begin(), 
+                                         _source_cdf.end(), test) - 
+                                         _source_cdf.begin();
+            index = std::min(index, num_regions - 1);
+            float* bounds = &_source_bounds[4*index];
+            int cell = _source_cells[index];
+
+            /* Uniformly sample within the bounding box */
+            neutron->_x = bounds[0] + (bounds[1] - bounds[0]) * 
+                                      (float(rand()) / RAND_MAX);
+            neutron->_y = bounds[2] + (bounds[3] - bounds[2]) * 
+                                      (float(rand()) / RAND_MAX);
+            neutron->_z = radius * ((float(rand()) / RAND_MAX) * 2.0 - 1.0);
+
+            /* Find the site in the local coordinates of its lattice cell */
+            float x = neutron->_x;
+            float y = neutron->_y;
+
+            if (cell >= 0) {
+                x -= _lattice->getCellCenterX(cell);
+                y -= _lattice->getCellCenterY(cell);
+            }
+
+            /* Accept the site if it is within both the region and the
+             * source sampling sphere */
+            if (_source_regions[index]->contains(x, y, neutron->_z) &&
+                neutron->_x * neutron->_x + neutron->_y * neutron->_y + 
+                neutron->_z * neutron->_z <= radius * radius) {
+                neutron->_region = _source_regions[index];
+                neutron->_cell = cell;
+                neutron->_x = x;
+                neutron->_y = y;
+
+                if (_compiled != NULL)
+                    neutron->_region_index = 
+                               _compiled->getRegionIndex(neutron->_region);
+                break;
+            }
         }
 
-        if (i == 1000)
-            log_printf(ERROR, "Unable to sample a source site with rejection "
-	         "sampling using a sampling radius of %f cm after 1000 "
-	         "attempts.", _source_sampling_radius);
+        if (i == 1000 || num_regions == 0)
+            log_printf(ERROR, "Unable to sample a source site within a region "
+                       "with a non-zero fission cross-section using a "
+                       "sampling radius of %f cm", _source_sampling_radius);
+
+        /* Randomly sample an isotropic unit direction vector */
+        float mu = (float(rand()) / RAND_MAX) * 2.0 - 1.0;
+        float phi = (float(rand()) / RAND_MAX) * 2.0 * M_PI;
+        float sin_theta = sqrt(1.0 - mu * mu);
 
-        /* Randomly sample a direction vector */
-        neutron->_u = (float(rand()) / RAND_MAX) * 2.0 - 1.0;
-        neutron->_v = (float(rand()) / RAND_MAX) * 2.0 - 1.0;
-        neutron->_w = (float(rand()) / RAND_MAX) * 2.0 - 1.0;
+        neutron->_u = sin_theta * cos(phi);
+        neutron->_v = sin_theta * sin(phi);
+        neutron->_w = mu;
     }
 
     return;
@@ -12,8 +12,13 @@
 #include <sys/stat.h>
 #include <omp.h>
 #include <vector>
+#include <map>
+#include <set>
 #include "Region.h"
-#include "Fissioner.h"
+#include "Lattice.h"
+#include "CompiledGeometry.h"
+#include "TrackRecorder.h"
+#include "Source.h"
 #include "TallyBank.h"
 #include "Timer.h"
 #endif
@@ -67,6 +72,9 @@ private:
     EquivalenceRegion* _moderator;
     /** A container of BOUNDED type regions if the geometry is HETEROGENEOUS */
     std::vector<BoundedRegion*> _regions;
+    /** The lattice filling a HETEROGENEOUS geometry, or NULL if the geometry
+     *  is filled by its regions */
+    Lattice* _lattice;
 
     /** The fuel pin radius for a heterogeneous-homogeneous equivalent
      *  geometry */
@@ -98,12 +106,85 @@ private:
     /** The first flight moderator-to-fuel collision probabilities */
     float* _prob_mf;
 
-    /** The fissioner used to sample new neutron fission emission energies */
-    Fissioner* _fissioner;
+    /** The source used to sample the energies of source neutrons */
+    Source* _source;
     /** A 3D spherical radius within which to sample random source sites */
     float _source_sampling_radius;
+    /** The BOUNDED type regions with a non-zero fission cross-section in 
+     *  which source sites are sampled */
+    std::vector<BoundedRegion*> _source_regions;
+    /** The xy-plane bounding boxes (x_min, x_max, y_min, y_max) of the 
+     *  source regions clipped to the source sampling sphere */
+    std::vector<float> _source_bounds;
+    /** The cumulative areas of the source regions' bounding boxes */
+    std::vector<float> _source_cdf;
+    /** The lattice cell of each source region, or -1 without a lattice */
+    std::vector<int> _source_cells;
+    /** Whether the source regions have been found since the regions or
+     *  source sampling radius last changed */
+    bool _source_regions_found;
+
+    /** The minimum x-coordinate of the uniform grid over the regions */
+    float _grid_x_min;
+    /** The minimum y-coordinate of the uniform grid over the regions */
+    float _grid_y_min;
+    /** The width of each grid cell along the x-axis */
+    float _grid_dx;
+    /** The width of each grid cell along the y-axis */
+    float _grid_dy;
+    /** The number of grid cells along the x-axis, or zero if the regions 
+     *  are searched linearly */
+    int _grid_nx;
+    /** The number of grid cells along the y-axis */
+    int _grid_ny;
+    /** The offset into the grid regions array for each grid cell */
+    std::vector<int> _grid_offsets;
+    /** The regions whose bounding boxes overlap each grid cell */
+    std::vector<BoundedRegion*> _grid_regions;
+    /** Whether or not the neighbors across each region's bounding surfaces
+     *  have been found */
+    bool _region_neighbors_found;
+    /** Whether or not neutrons are delta tracked in a HETEROGENEOUS 
+     *  geometry */
+    bool _delta_tracking;
+    /** The smallest ratio of the total cross-section in a neutron's region 
+     *  to the majorant for which the neutron is delta tracked */
+    float _delta_tracking_ratio;
+    /** A material with cross-section tables on the majorant's uniform 
+     *  lethargy grid, or NULL if neutrons are surface tracked */
+    Material* _majorant_material;
+    /** The largest total macroscopic cross-section of all of the materials
+     *  at each energy in the uniform lethargy grid */
+    std::vector<float> _majorant;
+    /** The REFLECTIVE and VACUUM surfaces bounding the geometry */
+    std::vector<Surface*> _boundary_surfaces;
+    /** The flattened regions, surfaces and tallies on which neutrons are
+     *  tracked in a HETEROGENEOUS geometry, or NULL if the geometry has
+     *  not been compiled since it last changed */
+    CompiledGeometry* _compiled;
+    /** Whether the volumes of the regions have been estimated since the
+     *  regions last changed */
+    bool _volumes_computed;
 
     void initializeProbModFuelRatios();
+    bool initializeRegions();
+    void initializeSourceRegions();
+    void initializeRegionGrid();
+    void initializeRegionNeighbors();
+    int linkRegionNeighbors(std::vector<BoundedRegion*>& regions);
+    bool initializeLattice();
+    void initializeMajorant();
+    float getMajorant(float energy) const;
+    float computeBoundaryDistance(neutron* neutron, Surface* reflected=NULL);
+    void surfaceTrackNeutron(neutron* neutron);
+    void deltaTrackNeutron(neutron* neutron);
+    void transportNeutron(neutron* neutron);
+    void recordTrackPoint(TrackRecorder* recorder, neutron* neutron,
+                          trackEvent event);
+    int getGridCell(float x, float y) const;
+    double computeRadicalInverse(int index, int base) const;
+    BoundedRegion* findRegion(neutron* neutron);
+    BoundedRegion* findRegion(float x, float y, float z);
 
 public:
     Geometry(spatialType spatial_type, const char* name=(const char*)"");
@@ -118,6 +199,9 @@ public:
     float getBucklingSquared();
     float getVolume();
     float getSourceSamplingRadius();
+    Source* getSource();
+    Lattice* getLattice();
+    CompiledGeometry* getCompiledGeometry();
 
     void setName(const char* name);
     void setSourceSamplingRadius(float radius);			
@@ -128,16 +212,110 @@ public:
     void setFuelPinRadius(float radius);
     void setPinCellPitch(float pitch);
     void setDancoffFactor(float dancoff);
+    void setDeltaTracking(bool delta_tracking, float min_ratio=0.1);
     void addRegion(Region* region);
+    void setLattice(Lattice* lattice);
     void setBucklingSquared(float buckling_squared);
+    void computeVolumes(int num_points=1000000);
 
     bool contains(neutron* neutron);
     bool contains(float x, float y, float z);
     void findContainingRegion(neutron* neutron);
     Region* findContainingRegion(float x, float y, float z);    
+
+    /* IMPORTANT: The following class method prototype must not be changed
+     * without changing Geometry.i to allow for the data array to be 
+     * transformed into a numpy array */
+    void rasterizeSlice(int* uids, int num_pixels, char* plane, 
+                        float location, float min1, float max1, float min2,
+                        float max2, int num1, bool material_uids=false);
     void runMonteCarloSimulation();
+    void recordTracks(TrackRecorder* recorder, int num_neutrons);
     void initializeSourceNeutron(neutron* neutron);
 };
 
 
+/**
+ * @brief Returns the uniform grid cell containing a point in the xy-plane.
+ * @param x the x-coordinate of interest
+ * @param y the y-coordinate of interest
+ * @return the index of the grid cell, or -1 if the point is outside of the
+ *         grid or the grid has not been built
+ */
+inline int Geometry::getGridCell(float x, float y) const {
+
+    if (_grid_nx == 0)
+        return -1;
+
+    float i = floor((x - _grid_x_min) / _grid_dx);
+    float j = floor((y - _grid_y_min) / _grid_dy);
+
+    if (i < 0 || j < 0 || i >= _grid_nx || j >= _grid_ny)
+        return -1;
+
+    return int(j) * _grid_nx + int(i);
+}
+
+
+/**
+ * @brief Moves a neutron to its next collision or surface crossing.
+ * @details The region containing the neutron is found, and the neutron is
+ *          delta tracked if the majorant has been built and is otherwise
+ *          surface tracked.
+ * @param neutron the neutron of interest
+ */
+inline void Geometry::transportNeutron(neutron* neutron) {
+
+    findContainingRegion(neutron);
+
+    if (_majorant_material != NULL)
+        deltaTrackNeutron(neutron);
+    else
+        surfaceTrackNeutron(neutron);
+}
+
+
+/**
+ * @brief Returns the radical inverse of an index in some base.
+ * @details The digits of the index in the base are mirrored about the 
+ *          decimal point, such that the radical inverses of successive 
+ *          indices in bases 2 and 3 are the coordinates of the Halton 
+ *          sequence in the unit square.
+ * @param index the index of interest
+ * @param base the base of the digits
+ * @return the radical inverse in [0, 1)
+ */
+inline double Geometry::computeRadicalInverse(int index, int base) const {
+
+    double inverse = 0.0;
+    double factor = 1.0 / base;
+
+    while (index > 0) {
+        inverse += (index % base) * factor;
+        index /= base;
+        factor /= base;
+    }
+
+    return inverse;
+}
+
+
+/**
+ * @brief Returns the majorant total macroscopic cross-section at some 
+ *        energy.
+ * @details The majorant is interpolated between the grid energies in the
+ *          same way as each material's cross-section tables, such that it
+ *          is at least as large as the total cross-section of each material.
+ * @param energy the energy (eV) of interest
+ * @return the majorant cross-section \f$ (cm^{-1}) \f$
+ */
+inline float Geometry::getMajorant(float energy) const {
+
+    float factor;
+    int index = _majorant_material->getXSTableIndex(energy, &factor);
+
+    return _majorant[index] + factor * (_majorant[index+1] - _majorant[index]);
+}
+
+
 #endif /* GEOMETRY_H_ */
@@ -2,6 +2,7 @@
 
 
 int Isotope::_n = 1;
+int Isotope::_last_xs_revision = 0;
 
 
 /**
@@ -21,6 +22,7 @@ Isotope::Isotope(char* isotope_name){
 
     _uid = _n;
     _n++;
+    _xs_revision = 0;
 
     _A_squared = _A * _A;
     _A_plus_one_squared = (_A + 1) * (_A + 1);
@@ -39,15 +41,30 @@ Isotope::Isotope(char* isotope_name){
     _capture_rescaled = false;
     _fission_rescaled = false;
     _rescaled = false;
+    _updating_xs = false;
+
+    /* By default cross-sections are not tabulated by temperature */
+    _temperature_interp = LINEAR_TEMPERATURE;
+
+    /* By default the resolved resonances are not represented by poles */
+    _multipole = NULL;
+
+    /* By default the cross-sections are stored as 32-bit floats */
+    _xs_precision = DEFAULT_XS_PRECISION;
+    _compact_elastic_xs = NULL;
+    _compact_capture_xs = NULL;
+    _compact_fission_xs = NULL;
+    _compact_absorb_xs = NULL;
+    _compact_total_xs = NULL;
 
     /* Attempt to load xs for this isotope - if the data 
      * exists in the cross-section library */
     loadXS();	
 	
     /* Rescales the isotope's cross sections */
-    _start_lethargy = 1E-5;
-    _end_lethargy = 2E7;
-    _num_energies = 100000;
+    _start_lethargy = DEFAULT_START_ENERGY;
+    _end_lethargy = DEFAULT_END_ENERGY;
+    _num_energies = DEFAULT_NUM_ENERGIES;
     rescaleXS(_start_lethargy, _end_lethargy, _num_energies);
  
     /* By default the thermal scattering cdfs have not been initialized */
@@ -99,6 +116,13 @@ Isotope::~Isotope() {
         delete [] _E_to_kT;
         delete [] _Eprime_to_E;
     }
+
+    clearTemperatureTables();
+
+    if (_multipole != NULL)
+        delete _multipole;
+
+    clearCompactXS();
 }
 
 
@@ -248,6 +272,37 @@ int Isotope::getNumXSEnergies(char* xs_type) const {
 }
 
 
+/**
+ * @brief Returns the cross-section type for a cross-section name.
+ * @param xs_type the name of the cross-section (ie, 'capture')
+ * @return the cross-section type, or UNKNOWN_XS if the name is not that of
+ *         a type of cross-section
+ */
+xsType Isotope::getXSType(char* xs_type) {
+
+    if (!strcmp(xs_type, "elastic"))
+        return ELASTIC_XS;
+
+    else if (!strcmp(xs_type, "capture"))
+        return CAPTURE_XS;
+
+    else if (!strcmp(xs_type, "fission"))
+        return FISSION_XS;
+
+    else if (!strcmp(xs_type, "absorption"))
+        return ABSORPTION_XS;
+
+    else if (!strcmp(xs_type, "total"))
+        return TOTAL_XS;
+
+    else if (!strcmp(xs_type, "transport"))
+        return TRANSPORT_XS;
+
+    log_printf(ERROR, "Unable to find a cross-section type for %s", xs_type);
+    return UNKNOWN_XS;
+}
+
+
 /**
  * @brief Fills an array with cross-section energy values.
  * @details This method is a helper function to allow PINSPEC users to
@@ -348,6 +403,54 @@ void Isotope::retrieveXS(float* xs, int num_xs, char* xs_type) const {
 }
 
 
+/**
+ * @brief Evaluates one of the isotope's microscopic cross-sections at each
+ *        energy in a numpy array.
+ * @details This is a helper function for users to evaluate cross-sections
+ *          at many energies from Python at the speed of C++. Although the
+ *          prototype for this function requires four array arguments, in
+ *          Python one only passes in the array of energies and the number
+ *          of energies, and a numpy array of the cross-sections is returned.
+ *          The cross-sections are evaluated at the isotope's temperature,
+ *          and are NaN if the type of cross-section is unknown. An example 
+ *          of how this function might be called in Python is as follows:
+ *
+ * @code
+ *          energies = numpy.logspace(-2, 4, 1000000)
+ *          xs = isotope.evaluateXS(energies, energies.size, 'capture')
+ * @endcode
+ *
+ * @param energies an array of energies (eV)
+ * @param num_energies the number of energies
+ * @param xs an array to fill with the microscopic cross-sections
+ * @param num_xs the number of cross-section values
+ * @param xs_type the type of cross-section (ie, 'capture')
+ */
+void Isotope::evaluateXS(double* energies, int num_energies, float* xs, 
+                         int num_xs, char* xs_type) const {
+
+    if (num_xs != num_energies) {
+        log_printf(ERROR, "Unable to evaluate the %s xs for isotope %s "
+                   "since the number of xs values is %d while the number "
+                   "of energies is %d", xs_type, _isotope_name, num_xs, 
+                   num_energies);
+        return;
+    }
+
+    xsType type = getXSType(xs_type);
+
+    if (type == UNKNOWN_XS) {
+        std::fill(xs, xs + num_xs, std::numeric_limits<float>::quiet_NaN());
+        return;
+    }
+
+    /* Energies are passed in from numpy in double precision */
+    std::vector<float> float_energies(energies, energies + num_energies);
+
+    evaluateXS(type, float_energies.data(), xs, num_energies, _T);
+}
+
+
 /**
  * @brief Sets the elastic cross-section data for this isotope.
  * @details This is a helper function for users to assign the cross-section
@@ -422,7 +525,7 @@ void Isotope::setElasticXS(double* energies, int num_energies,
 
     _elastic_rescaled = false;
 
-    rescaleXS(pow(10., _start_lethargy), pow(10., _end_lethargy), _num_energies);
+    updateRescaledXS();
 
     return;
 }
@@ -503,8 +606,7 @@ void Isotope::setCaptureXS(double* energies, int num_energies,
 
     _capture_rescaled = false;
 
-    rescaleXS(pow(10., _start_lethargy), pow(10., _end_lethargy), 
-	      _num_energies);
+    updateRescaledXS();
 
     return;
 }
@@ -584,8 +686,7 @@ void Isotope::setFissionXS(double* energies, int num_energies,
 
     _fission_rescaled = false;
 
-    rescaleXS(pow(10., _start_lethargy), pow(10., _end_lethargy), 
-	      _num_energies);
+    updateRescaledXS();
 
     return;
 }
@@ -681,8 +782,7 @@ void Isotope::setMultigroupElasticXS(double* energies, int num_energies,
 
 	/* Rescales the cross-section to a uniform lethargy grid */
         _elastic_rescaled = false;
-        rescaleXS(pow(10., _start_lethargy), pow(10., _end_lethargy), 
-		  _num_energies);
+        updateRescaledXS();
 
         return;
 }
@@ -781,7 +881,7 @@ void Isotope::setMultigroupCaptureXS(double* energies, int num_energies,
 
     /* Rescale the cross-section to a uniform lethargy grid */
     _capture_rescaled = false;
-    rescaleXS(pow(10.,_start_lethargy), pow(10., _end_lethargy), _num_energies);
+    updateRescaledXS();
     
     return;
 }
@@ -880,13 +980,68 @@ void Isotope::setMultigroupFissionXS(double* energies, int num_energies,
 
     /* Rescale the cross-section onto a uniform lethargy grid */
     _fission_rescaled = false;
-    rescaleXS(pow(10., _start_lethargy), pow(10., _end_lethargy), 
-	      _num_energies);
+    updateRescaledXS();
 
     return;
 }
 
 
+/**
+ * @brief Begins a cross-section update during which rescaling is deferred.
+ * @details Each of the cross-section setters normally rescales the new 
+ *          cross-section onto the uniform lethargy grid and regenerates the
+ *          absorption and total cross-sections. When several cross-sections
+ *          are set in a row this work is repeated for each one. Between 
+ *          calls to beginXSUpdate() and commitXSUpdate() the setters only 
+ *          store the new data, and the rescaling is done once on commit. 
+ *          The absorption and total cross-sections are not updated until 
+ *          the update is committed. A user may call this method from within
+ *          Python as follows:
+ *
+ * @code
+ *          isotope.beginXSUpdate()
+ *          isotope.setMultigroupElasticXS(energies, elastic_xs)
+ *          isotope.setMultigroupFissionXS(energies, fission_xs)
+ *          isotope.commitXSUpdate()
+ * @endcode
+ */
+void Isotope::beginXSUpdate() {
+
+    if (_updating_xs)
+        log_printf(ERROR, "Unable to begin a cross-section update for "
+                   "isotope %s since an update has already begun", 
+                   _isotope_name);
+
+    _updating_xs = true;
+}
+
+
+/**
+ * @brief Commits a cross-section update by rescaling each cross-section
+ *        which has been set since beginXSUpdate() was called and 
+ *        regenerating the absorption and total cross-sections.
+ */
+void Isotope::commitXSUpdate() {
+
+    if (!_updating_xs)
+        log_printf(ERROR, "Unable to commit a cross-section update for "
+                   "isotope %s since no update has begun", _isotope_name);
+
+    _updating_xs = false;
+    updateRescaledXS();
+}
+
+
+/**
+ * @brief Returns whether a cross-section update has begun and not yet been
+ *        committed.
+ * @return true if rescaling is deferred; otherwise false
+ */
+bool Isotope::isUpdatingXS() const {
+    return _updating_xs;
+}
+
+
 /**
  * @brief Returns the microscopic elastic scattering cross-section value for 
  *        some energy.
@@ -938,6 +1093,9 @@ float Isotope::getElasticXS(int energy_index) const {
 		       " bounds", _isotope_name, energy_index);
 	}
 
+	if (_compact_elastic_xs != NULL)
+	    return _compact_elastic_xs->getValue(energy_index);
+
 	return _elastic_xs[energy_index];
 }
 
@@ -992,6 +1150,9 @@ float Isotope::getAbsorptionXS(int energy_index) const {
 		   " bounds", _isotope_name, energy_index);
     }
 
+    if (_compact_absorb_xs != NULL)
+        return _compact_absorb_xs->getValue(energy_index);
+
     return _absorb_xs[energy_index];
 }
 
@@ -1045,6 +1206,9 @@ float Isotope::getCaptureXS(int energy_index) const {
 		   " isotope %s since the energy index %d is out of"
 		   " bounds", _isotope_name, energy_index);
 
+    if (_compact_capture_xs != NULL)
+        return _compact_capture_xs->getValue(energy_index);
+
     return _capture_xs[energy_index];
 }
 
@@ -1099,6 +1263,9 @@ float Isotope::getFissionXS(int energy_index) const {
 		   " bounds", _isotope_name, energy_index);
     }
 
+    if (_compact_fission_xs != NULL)
+        return _compact_fission_xs->getValue(energy_index);
+
     return _fission_xs[energy_index];
 }
 
@@ -1164,6 +1331,9 @@ float Isotope::getTotalXS(int energy_index) const {
 		       " bounds", _isotope_name, energy_index);
 	}
 
+	if (_compact_total_xs != NULL)
+	    return _compact_total_xs->getValue(energy_index);
+
 	return _total_xs[energy_index];
     }
 
@@ -1210,6 +1380,318 @@ float Isotope::getTransportXS(int energy_index) const {
 }
 
 
+/**
+ * @brief Returns the microscopic elastic scattering cross-section value for 
+ *        some energy and temperature.
+ * @details If temperature tables have been added to this isotope, the 
+ *          cross-section is interpolated between the tables bracketing 
+ *          the temperature. Otherwise the temperature is ignored. If a
+ *          multipole representation is used, elastic scattering and capture
+ *          within its energy range are evaluated from the poles.
+ * @param energy the energy (eV) of interest
+ * @param temperature the temperature (K) of interest
+ * @return the microscopic elastic scattering cross-section
+ */
+float Isotope::getElasticXS(float energy, float temperature) const {
+
+    if (_multipole != NULL && _multipole->contains(energy))
+        return _multipole->getElasticXS(energy, temperature);
+
+    if (_xs_temperatures.empty())
+        return getElasticXS(energy);
+
+    return interpolateTemperatureTables(_elastic_xs_tables, energy, 
+                                                              temperature);
+}
+
+
+/**
+ * @brief Returns the microscopic absorption cross-section value for some 
+ *        energy and temperature.
+ * @details If temperature tables have been added to this isotope, the 
+ *          cross-section is interpolated between the tables bracketing 
+ *          the temperature. Otherwise the temperature is ignored. If a
+ *          multipole representation is used, elastic scattering and capture
+ *          within its energy range are evaluated from the poles.
+ * @param energy the energy (eV) of interest
+ * @param temperature the temperature (K) of interest
+ * @return the microscopic absorption cross-section
+ */
+float Isotope::getAbsorptionXS(float energy, float temperature) const {
+
+    if (_multipole != NULL && _multipole->contains(energy))
+        return _multipole->getCaptureXS(energy, temperature) + 
+               getFissionXS(energy, temperature);
+
+    if (_xs_temperatures.empty())
+        return getAbsorptionXS(energy);
+
+    return interpolateTemperatureTables(_absorb_xs_tables, energy, 
+                                                             temperature);
+}
+
+
+/**
+ * @brief Returns the microscopic capture cross-section value for some 
+ *        energy and temperature.
+ * @details If temperature tables have been added to this isotope, the 
+ *          cross-section is interpolated between the tables bracketing 
+ *          the temperature. Otherwise the temperature is ignored. If a
+ *          multipole representation is used, elastic scattering and capture
+ *          within its energy range are evaluated from the poles.
+ * @param energy the energy (eV) of interest
+ * @param temperature the temperature (K) of interest
+ * @return the microscopic capture cross-section
+ */
+float Isotope::getCaptureXS(float energy, float temperature) const {
+
+    if (_multipole != NULL && _multipole->contains(energy))
+        return _multipole->getCaptureXS(energy, temperature);
+
+    if (_xs_temperatures.empty())
+        return getCaptureXS(energy);
+
+    return interpolateTemperatureTables(_capture_xs_tables, energy, 
+                                                              temperature);
+}
+
+
+/**
+ * @brief Returns the microscopic fission cross-section value for some 
+ *        energy and temperature.
+ * @details If temperature tables have been added to this isotope, the 
+ *          cross-section is interpolated between the tables bracketing 
+ *          the temperature. Otherwise the temperature is ignored.
+ * @param energy the energy (eV) of interest
+ * @param temperature the temperature (K) of interest
+ * @return the microscopic fission cross-section
+ */
+float Isotope::getFissionXS(float energy, float temperature) const {
+
+    if (_xs_temperatures.empty())
+        return getFissionXS(energy);
+
+    return interpolateTemperatureTables(_fission_xs_tables, energy, 
+                                                              temperature);
+}
+
+
+/**
+ * @brief Returns the microscopic total cross-section value for some 
+ *        energy and temperature.
+ * @details If temperature tables have been added to this isotope, the 
+ *          cross-section is interpolated between the tables bracketing 
+ *          the temperature. Otherwise the temperature is ignored. If a
+ *          multipole representation is used, elastic scattering and capture
+ *          within its energy range are evaluated from the poles.
+ * @param energy the energy (eV) of interest
+ * @param temperature the temperature (K) of interest
+ * @return the microscopic total cross-section
+ */
+float Isotope::getTotalXS(float energy, float temperature) const {
+
+    if (_multipole != NULL && _multipole->contains(energy)) {
+        float elastic_xs, capture_xs;
+        _multipole->evaluate(energy, temperature, &elastic_xs, &capture_xs);
+        return elastic_xs + capture_xs + getFissionXS(energy, temperature);
+    }
+
+    if (_xs_temperatures.empty())
+        return getTotalXS(energy);
+
+    return interpolateTemperatureTables(_total_xs_tables, energy, 
+                                                            temperature);
+}
+
+
+/**
+ * @brief Returns the microscopic transport cross-section value for some 
+ *        energy and temperature.
+ * @details The transport cross-section is computed from the total and 
+ *          elastic scattering cross-sections at the temperature of interest:
+ *
+ *          \f$ \sigma_{tr} = \sigma_t - \left<\mu\right>\sigma_s \f$
+ *
+ * @param energy the energy (eV) of interest
+ * @param temperature the temperature (K) of interest
+ * @return the microscopic transport cross-section
+ */
+float Isotope::getTransportXS(float energy, float temperature) const {
+    return (getTotalXS(energy, temperature) - 
+            _mu_avg * getElasticXS(energy, temperature));
+}
+
+
+/**
+ * @brief Evaluates a microscopic cross-section for an array of energies.
+ * @details The energies are evaluated in parallel.
+ * @param type the cross-section type
+ * @param energies an array of energies (eV)
+ * @param xs an array to fill with the microscopic cross-sections
+ * @param num_energies the number of energies
+ * @param temperature the temperature (K) of interest
+ */
+void Isotope::evaluateXS(xsType type, float* energies, float* xs, 
+                         int num_energies, float temperature) const {
+
+    #pragma omp parallel for
+    for (int i=0; i < num_energies; i++) {
+
+        switch (type) {
+            case ELASTIC_XS:
+                xs[i] = getElasticXS(energies[i], temperature);
+                break;
+            case CAPTURE_XS:
+                xs[i] = getCaptureXS(energies[i], temperature);
+                break;
+            case FISSION_XS:
+                xs[i] = getFissionXS(energies[i], temperature);
+                break;
+            case ABSORPTION_XS:
+                xs[i] = getAbsorptionXS(energies[i], temperature);
+                break;
+            case TOTAL_XS:
+                xs[i] = getTotalXS(energies[i], temperature);
+                break;
+            case TRANSPORT_XS:
+                xs[i] = getTransportXS(energies[i], temperature);
+                break;
+            case UNKNOWN_XS:
+                xs[i] = std::numeric_limits<float>::quiet_NaN();
+                break;
+        }
+    }
+}
+
+
+/**
+ * @brief Interpolates a cross-section from the isotope's temperature tables.
+ * @details The cross-section is first linearly interpolated in lethargy
+ *          within the two tables which bracket the temperature, and then
+ *          interpolated between those two tables either linearly in 
+ *          temperature or in the square root of temperature. Temperatures
+ *          outside the range of the tables use the nearest table.
+ * @param tables the temperature tables for a cross-section type
+ * @param energy the energy (eV) of interest
+ * @param temperature the temperature (K) of interest
+ * @return the interpolated microscopic cross-section
+ */
+float Isotope::interpolateTemperatureTables(const std::vector<float*>& tables,
+                                      float energy, float temperature) const {
+
+    /* Find the lower index and interpolation factor into the uniform 
+     * lethargy grid - these are shared by all temperature tables */
+    int index = getEnergyGridIndex(energy);
+
+    if (index > _num_energies - 2)
+        index = _num_energies - 2;
+
+    float lower_lethargy = _start_lethargy + _delta_lethargy * index;
+    float energy_factor = (log10(energy) - lower_lethargy) / _delta_lethargy;
+
+    /* Find the tables which bracket the temperature */
+    int num_temperatures = _xs_temperatures.size();
+    int lower_table = 0;
+    float temp_factor = 0.0;
+
+    if (temperature >= _xs_temperatures[num_temperatures-1])
+        lower_table = num_temperatures - 1;
+
+    else if (temperature > _xs_temperatures[0]) {
+
+        while (_xs_temperatures[lower_table+1] < temperature)
+            lower_table++;
+
+        float lower_T = _xs_temperatures[lower_table];
+        float upper_T = _xs_temperatures[lower_table+1];
+
+        if (_temperature_interp == SQRT_TEMPERATURE)
+            temp_factor = (sqrt(temperature) - sqrt(lower_T)) / 
+                          (sqrt(upper_T) - sqrt(lower_T));
+        else
+            temp_factor = (temperature - lower_T) / (upper_T - lower_T);
+    }
+
+    /* Interpolate in lethargy within the lower temperature table */
+    const float* lower = tables[lower_table];
+    float xs = lower[index] + energy_factor * (lower[index+1] - lower[index]);
+
+    /* Interpolate in temperature to the upper temperature table */
+    if (temp_factor > 0.0) {
+        const float* upper = tables[lower_table+1];
+        float upper_xs = upper[index] + energy_factor * 
+                                        (upper[index+1] - upper[index]);
+        xs += temp_factor * (upper_xs - xs);
+    }
+
+    return xs;
+}
+
+
+/**
+ * @brief Returns the number of temperature tables for this isotope.
+ * @return the number of temperature tables
+ */
+int Isotope::getNumTemperatureTables() const {
+    return _xs_temperatures.size();
+}
+
+
+/**
+ * @brief Returns the scheme used to interpolate between temperature tables.
+ * @return the temperature interpolation scheme
+ */
+temperatureInterpType Isotope::getTemperatureInterpolation() const {
+    return _temperature_interp;
+}
+
+
+/**
+ * @brief Returns the format used to store the cross-sections on the uniform
+ *        lethargy grid for lookups.
+ * @return the cross-section precision
+ */
+xsPrecision Isotope::getXSPrecision() const {
+    return _xs_precision;
+}
+
+
+/**
+ * @brief Returns the maximum relative error of a cross-section stored in a
+ *        16-bit format with respect to the 32-bit cross-section.
+ * @details This may be used to validate a reduced precision format for the
+ *          isotopes in a model from within Python as follows:
+ *
+ * @code
+ *          u238.setXSPrecision(BFLOAT16_XS)
+ *          error = u238.getXSPrecisionError('capture')
+ * @endcode
+ *
+ * @param xs_type the type of cross-section ('elastic', 'capture', 'fission',
+ *        'absorption' or 'total')
+ * @return the maximum relative error, or 0 for 32-bit cross-sections
+ */
+float Isotope::getXSPrecisionError(char* xs_type) const {
+
+    if (!strcmp(xs_type, "elastic") && _compact_elastic_xs != NULL)
+        return _compact_elastic_xs->getMaxRelativeError(_elastic_xs);
+
+    else if (!strcmp(xs_type, "capture") && _compact_capture_xs != NULL)
+        return _compact_capture_xs->getMaxRelativeError(_capture_xs);
+
+    else if (!strcmp(xs_type, "fission") && _compact_fission_xs != NULL)
+        return _compact_fission_xs->getMaxRelativeError(_fission_xs);
+
+    else if (!strcmp(xs_type, "absorption") && _compact_absorb_xs != NULL)
+        return _compact_absorb_xs->getMaxRelativeError(_absorb_xs);
+
+    else if (!strcmp(xs_type, "total") && _compact_total_xs != NULL)
+        return _compact_total_xs->getMaxRelativeError(_total_xs);
+
+    return 0.0;
+}
+
+
 /**
  * @brief This method returns true if the thermal scattering distributions
  *        for this isotope are to be used when sampling outgoing collision 
@@ -1221,6 +1703,25 @@ bool Isotope::usesThermalScattering() {
 }
 
 
+/**
+ * @brief Returns true if the isotope uses a windowed multipole representation
+ *        for its resolved resonances.
+ * @return whether or not the isotope uses a multipole representation
+ */
+bool Isotope::usesMultipole() const {
+    return (_multipole != NULL);
+}
+
+
+/**
+ * @brief Returns a pointer to the isotope's multipole representation.
+ * @return a pointer to the Multipole, or NULL if it is not used
+ */
+Multipole* Isotope::getMultipole() const {
+    return _multipole;
+}
+
+
 /**
  * @brief This method returns whether or not the Isotope's cross-sections 
  *        have been rescaled to a uniform lethargy grid.
@@ -1231,6 +1732,47 @@ bool Isotope::isRescaled() const {
 }
 
 
+/**
+ * @brief Returns the starting lethargy (the base 10 logarithm of the 
+ *        energy) of the uniform lethargy grid.
+ * @return the starting lethargy
+ */
+float Isotope::getStartLethargy() const {
+    return _start_lethargy;
+}
+
+
+/**
+ * @brief Returns the final lethargy of the uniform lethargy grid.
+ * @return the final lethargy
+ */
+float Isotope::getEndLethargy() const {
+    return _end_lethargy;
+}
+
+
+/**
+ * @brief Returns the space between lethargies in the uniform lethargy grid.
+ * @return the space between lethargies
+ */
+float Isotope::getDeltaLethargy() const {
+    return _delta_lethargy;
+}
+
+
+/**
+ * @brief Returns the revision of the isotope's cross-sections.
+ * @details The revision is renewed whenever the isotope's cross-sections
+ *          are set, rescaled or change representation. This allows data 
+ *          derived from the cross-sections of many isotopes (ie, a material's
+ *          cross-section tables) to check that it is up to date.
+ * @return the cross-section revision
+ */
+int Isotope::getXSRevision() const {
+    return _xs_revision;
+}
+
+
 /**
  * @brief Set the atomic number and update alpha, eta and rho.
  * @details Computes alpha, eta, rho and mu as follows:
@@ -1286,6 +1828,85 @@ void Isotope::useThermalScattering() {
 }
 
 
+/**
+ * @brief Informs isotope to evaluate its elastic scattering and capture 
+ *        cross-sections in the resolved resonance range from a windowed 
+ *        multipole representation.
+ * @details The poles and residues are generated from the single-level 
+ *          Breit-Wigner resonance parameters in the isotope's "-RP.txt" 
+ *          file in the cross-section library. The cross-section at any 
+ *          temperature may then be computed from a handful of Faddeeva 
+ *          function evaluations rather than from pre-broadened tables. 
+ *          Energies outside of the multipole range continue to use the 
+ *          tabulated cross-sections. A user may call this method from 
+ *          within Python as follows:
+ *
+ * @code
+ *          u238.useMultipole(num_windows=1000, energy_min=1., 
+ *                                               energy_max=2E4)
+ * @endcode
+ *
+ * @param num_windows the number of windows
+ * @param energy_min the minimum energy (eV) for the multipole representation
+ * @param energy_max the maximum energy (eV) for the multipole representation,
+ *        or zero to use the energy of the highest resonance
+ */
+void Isotope::useMultipole(int num_windows, float energy_min, 
+                           float energy_max) {
+
+    float* resonance_energies;
+    float* gamma_n;
+    float* gamma_g;
+    float sigma_p;
+
+    int num_resonances = loadResonanceParameters(_isotope_name, 
+                                                 &resonance_energies, 
+                                                 &gamma_n, &gamma_g, &sigma_p);
+
+    if (num_resonances == 0) {
+        log_printf(ERROR, "Unable to use a multipole representation for "
+                   "isotope %s since no resonance parameters were found in "
+                   "the cross-section library", _isotope_name);
+        return;
+    }
+
+    if (energy_max == 0.0)
+        energy_max = *std::max_element(resonance_energies, 
+                                       resonance_energies + num_resonances);
+
+    /* Generate the poles before replacing any existing representation */
+    Multipole* multipole = new Multipole(_A);
+    multipole->generatePoles(resonance_energies, gamma_n, gamma_g, 
+                             num_resonances, sigma_p, num_windows, 
+                             energy_min, energy_max);
+
+    if (multipole->getNumWindows() == 0)
+        delete multipole;
+    else {
+        neglectMultipole();
+        _multipole = multipole;
+    }
+
+    delete [] resonance_energies;
+    delete [] gamma_n;
+    delete [] gamma_g;
+}
+
+
+/**
+ * @brief Informs isotope to use its tabulated cross-sections at all 
+ *        energies rather than a windowed multipole representation.
+ */
+void Isotope::neglectMultipole() {
+
+    if (_multipole != NULL)
+        delete _multipole;
+
+    _multipole = NULL;
+    _xs_revision = ++_last_xs_revision;
+}
+
+
 /**
  * @brief Inform isotope that it is fissionable.
  */
@@ -1294,14 +1915,173 @@ void Isotope::makeFissionable() {
 }
 
 
+/**
+ * @brief Adds the isotope's current cross-sections as the table for some 
+ *        temperature.
+ * @details The isotope's cross-sections on the uniform lethargy grid are 
+ *          copied into a new table for the temperature. Once one or more 
+ *          tables have been added, cross-sections requested at some 
+ *          temperature are interpolated between the tables rather than
+ *          using the isotope's current cross-sections. A table which
+ *          already exists for the temperature is replaced. For example, 
+ *          a user may build tables from Doppler broadened SLBW 
+ *          cross-sections in Python as follows:
+ *
+ * @code
+ *          for T in [300., 600., 900., 1200.]:
+ *              slbw.buildSLBWXS('U-238', T, 'capture')
+ *              u238.loadXS('capture')
+ *              u238.addTemperatureTable(T)
+ * @endcode
+ *
+ * @param temperature the temperature (K) of the cross-sections
+ */
+void Isotope::addTemperatureTable(float temperature) {
+
+    if (temperature <= 0.0) {
+        log_printf(ERROR, "Unable to add a cross-section table for isotope %s"
+                   " at a temperature of %f K since the temperature must be "
+                   "positive", _isotope_name, temperature);
+        return;
+    }
+
+    if (!_rescaled) {
+        log_printf(ERROR, "Unable to add a cross-section table for isotope %s"
+                   " since its cross-sections have not been rescaled onto a "
+                   "uniform lethargy grid", _isotope_name);
+        return;
+    }
+
+    /* Copy each cross-section type on the uniform lethargy grid */
+    float* elastic_xs = new float[_num_energies];
+    float* capture_xs = new float[_num_energies];
+    float* fission_xs = new float[_num_energies];
+    float* absorb_xs = new float[_num_energies];
+    float* total_xs = new float[_num_energies];
+
+    memcpy(elastic_xs, _elastic_xs, sizeof(float)*_num_energies);
+    memcpy(capture_xs, _capture_xs, sizeof(float)*_num_energies);
+    memcpy(fission_xs, _fission_xs, sizeof(float)*_num_energies);
+    memcpy(absorb_xs, _absorb_xs, sizeof(float)*_num_energies);
+    memcpy(total_xs, _total_xs, sizeof(float)*_num_energies);
+
+    /* Find where the table belongs to keep the temperatures sorted */
+    int index = 0;
+    int num_temperatures = _xs_temperatures.size();
+
+    while (index < num_temperatures && _xs_temperatures[index] < temperature)
+        index++;
+
+    /* Replace an existing table for the same temperature */
+    if (index < num_temperatures && _xs_temperatures[index] == temperature) {
+        delete [] _elastic_xs_tables[index];
+        delete [] _capture_xs_tables[index];
+        delete [] _fission_xs_tables[index];
+        delete [] _absorb_xs_tables[index];
+        delete [] _total_xs_tables[index];
+
+        _elastic_xs_tables[index] = elastic_xs;
+        _capture_xs_tables[index] = capture_xs;
+        _fission_xs_tables[index] = fission_xs;
+        _absorb_xs_tables[index] = absorb_xs;
+        _total_xs_tables[index] = total_xs;
+    }
+
+    /* Otherwise insert a new table */
+    else {
+        _xs_temperatures.insert(_xs_temperatures.begin() + index, temperature);
+        _elastic_xs_tables.insert(_elastic_xs_tables.begin() + index, 
+                                  elastic_xs);
+        _capture_xs_tables.insert(_capture_xs_tables.begin() + index, 
+                                  capture_xs);
+        _fission_xs_tables.insert(_fission_xs_tables.begin() + index, 
+                                  fission_xs);
+        _absorb_xs_tables.insert(_absorb_xs_tables.begin() + index, absorb_xs);
+        _total_xs_tables.insert(_total_xs_tables.begin() + index, total_xs);
+    }
+
+    _xs_revision = ++_last_xs_revision;
+
+    log_printf(INFO, "Added a cross-section table at %f K for isotope %s", 
+               temperature, _isotope_name);
+
+    return;
+}
+
+
+/**
+ * @brief Removes all of the isotope's temperature tables.
+ * @details After the tables are removed the isotope's current cross-sections
+ *          are used at all temperatures.
+ */
+void Isotope::clearTemperatureTables() {
+
+    if (_xs_temperatures.empty())
+        return;
+
+    _xs_revision = ++_last_xs_revision;
+
+    for (int i=0; i < (int)_xs_temperatures.size(); i++) {
+        delete [] _elastic_xs_tables[i];
+        delete [] _capture_xs_tables[i];
+        delete [] _fission_xs_tables[i];
+        delete [] _absorb_xs_tables[i];
+        delete [] _total_xs_tables[i];
+    }
+
+    _xs_temperatures.clear();
+    _elastic_xs_tables.clear();
+    _capture_xs_tables.clear();
+    _fission_xs_tables.clear();
+    _absorb_xs_tables.clear();
+    _total_xs_tables.clear();
+}
+
+
+/**
+ * @brief Sets the scheme used to interpolate between temperature tables.
+ * @param interp the temperature interpolation scheme (LINEAR_TEMPERATURE 
+ *        or SQRT_TEMPERATURE)
+ */
+void Isotope::setTemperatureInterpolation(temperatureInterpType interp) {
+    _temperature_interp = interp;
+}
+
+
+/**
+ * @brief Sets the format used to store the cross-sections on the uniform
+ *        lethargy grid for lookups.
+ * @details The 32-bit cross-sections are always kept, such that they may be
+ *          retrieved or modified, but a 16-bit copy is read for each lookup.
+ *          This halves the memory traffic for cross-section lookups in 
+ *          models with many isotopes at the cost of a small loss of 
+ *          precision, which may be found with getXSPrecisionError(). The
+ *          temperature tables are always stored as 32-bit floats.
+ * @param precision the cross-section precision (FLOAT32_XS, FLOAT16_XS, 
+ *        BFLOAT16_XS or LOG16_XS)
+ */
+void Isotope::setXSPrecision(xsPrecision precision) {
+
+    _xs_precision = precision;
+    _xs_revision = ++_last_xs_revision;
+
+    if (_rescaled)
+        compactXS();
+    else
+        clearCompactXS();
+}
+
+
 /**
  * @brief Load the ENDF cross-section data from ASCII files into arrays
  *        for this isotope.
  * @details This method finds the appropriate ENDF data files for the isotope
  *          in the PINSPEC cross-section library based on the user-defined 
- *          name of the isotope. If the appropriate files are not found the
- *          method will return an exception. If only capture and elastic
- *          scattering cross-section data files are discovered in the 
+ *          name of the isotope. Any cross-section overrides which have been
+ *          set for the isotope (ie, by the SLBW module) are used in place of
+ *          the corresponding data files. If the appropriate files are not 
+ *          found the method will return an exception. If only capture and 
+ *          elastic scattering cross-section data files are discovered in the 
  *          cross-section library then the isotope is not fissionable; otherwise
  *          if a fission cross-section file is found then the isotope is 
  *          fissionable. Finally, after all cross-sections are parsed in from
@@ -1314,105 +2094,71 @@ void Isotope::loadXS() {
     log_printf(INFO, "Loading isotope %s", _isotope_name);
 
     /* initialize variables */
-    std::string directory = getXSLibDirectory();
-    std::string filename;
-    struct stat buffer;
     float* energies;
     float* xs_values;
+    int num_xs;
+
+    /* The isotope is rescaled onto the default uniform lethargy grid once 
+     * it is loaded, so prefetched data may be taken already on the grid */
+    bool rescaled;
 
     /* Set this isotope's appropriate cross-sections using the data structure */
     /********************************** ELASTIC *******************************/
-    /* Check whether an elastic cross-section file exists for isotope */
+    /* Check whether elastic cross-section data exists for isotope */
+    num_xs = loadCrossSections(_isotope_name, "elastic", &energies, 
+                               &xs_values, &rescaled);
 
-    filename = directory + _isotope_name + "-elastic.txt";
-
-    if (stat(filename.c_str(), &buffer))
+    if (num_xs == 0)
 	log_printf(ERROR, "Unable to load elastic xs for isotope %s"
 		   " since no data was found in the cross-section"
-		   " file %s for this isotope", filename.c_str(), 
-		   _isotope_name);
-
-    log_printf(INFO, "Loading %s-elastic.txt for isotope %s", 
-				_isotope_name, _isotope_name);
-
-    /* Find the number of cross-section values in the file */
-    _num_elastic_xs = getNumCrossSectionDataPoints(filename.c_str());
-
-    /* Initialize data structures to store cross-section values */
-    energies = new float[_num_elastic_xs];
-    xs_values = new float[_num_elastic_xs];
-
-    /* Parse the file into the data structures */
-    parseCrossSections(filename.c_str(), energies, xs_values);
+		   " library directory %s", _isotope_name, 
+		   getXSLibDirectory());
 
-    setElasticXS(xs_values, energies, _num_elastic_xs);
+    setElasticXS(xs_values, energies, num_xs);
+    _elastic_rescaled = rescaled;
 
 
     /********************************** CAPTURE *******************************/
-    /* Check whether a capture cross-section file exists for isotope */
+    /* Check whether capture cross-section data exists for isotope */
+    num_xs = loadCrossSections(_isotope_name, "capture", &energies, 
+                               &xs_values, &rescaled);
 
-    filename = directory + _isotope_name + "-capture.txt";
-
-    if (stat(filename.c_str(), &buffer))
+    if (num_xs == 0)
 	log_printf(ERROR, "Unable to load capture xs for isotope %s"
 		   " since no data was found in the cross-section"
-		   " file %s for this isotope", filename.c_str(), _isotope_name); 
-
-    log_printf(INFO, "Loading %s-capture.txt for isotope %s", 
-				_isotope_name, _isotope_name);
-
-    /* Find the number of cross-section values in the file */
-    _num_capture_xs = getNumCrossSectionDataPoints(filename.c_str());
-
-    /* Initialize data structures to store cross-section values */
-    energies = new float[_num_capture_xs];
-    xs_values = new float[_num_capture_xs];
+		   " library directory %s", _isotope_name, 
+		   getXSLibDirectory());
 
-    /* Parse the file into the data structures */
-    parseCrossSections(filename.c_str(), energies, xs_values);
-
-    setCaptureXS(xs_values, energies, _num_capture_xs);
+    setCaptureXS(xs_values, energies, num_xs);
+    _capture_rescaled = rescaled;
 
     /********************************* FISSION ********************************/
-    /* Check whether a fission cross-section file exists for isotope */
-
-    filename = directory + _isotope_name + "-fission.txt";
+    /* Check whether fission cross-section data exists for isotope */
+    num_xs = loadCrossSections(_isotope_name, "fission", &energies, 
+                               &xs_values, &rescaled);
 
     /* If this isotope is fissionable and it finds it's fission xs */
-    if (!stat(filename.c_str(), &buffer)) {
-
-        log_printf(INFO, "Loading %s-fission.txt for isotope %s", 
-					_isotope_name, _isotope_name);
-
-        /* Find the number of cross-section values in the file */
-        _num_fission_xs = getNumCrossSectionDataPoints(filename.c_str());
-
-        /* Initialize data structures to store cross-section values */
-        energies = new float[_num_fission_xs];
-        xs_values = new float[_num_fission_xs];
-
-        /* Parse the file into the data structures */
-        parseCrossSections(filename.c_str(), energies, xs_values);
-
-        setFissionXS(xs_values, energies, _num_fission_xs);
+    if (num_xs > 0) {
+        setFissionXS(xs_values, energies, num_xs);
+        _fission_rescaled = rescaled;
         makeFissionable();
     }
     
-    /* If this isotope is not fissionable and it does not find a data file,
+    /* If this isotope is not fissionable and it does not find any data,
      * set the fission cross-section to zero */
     else {
 
 	/* Initialize data structures to store cross-section values */
-        _num_fission_xs = 2;
-	energies = new float[_num_fission_xs];
-	xs_values = new float[_num_fission_xs];
+        num_xs = 2;
+	energies = new float[num_xs];
+	xs_values = new float[num_xs];
 
         energies[0] = 1E-7;
         energies[1] = 1E7;
         xs_values[0] = 0.0;
         xs_values[1] = 0.0;
 
-	setFissionXS(xs_values, energies, _num_fission_xs);
+	setFissionXS(xs_values, energies, num_xs);
     }
 
     return;
@@ -1425,8 +2171,10 @@ void Isotope::loadXS() {
  * @details This method finds the appropriate ENDF data file for the isotope
  *          in the PINSPEC cross-section library based on the user-defined name
  *          of the isotope as well as the type of cross-section input ('capture'
- *          'elastic', or 'fission'). If the appropriate file is not found the
- *          method will return an exception.  Finally, after the cross-section
+ *          'elastic', or 'fission'). If a cross-section override has been set
+ *          for the isotope (ie, by the SLBW module) it is used instead of the
+ *          data file. If no data is found the method will return an 
+ *          exception.  Finally, after the cross-section
  *          is parsed in from the data file, this method recomputes a total
  *          cross-section and an absorption cross-section and then rescales 
  *          all cross-sections onto a uniform lethargy grid to allow for 
@@ -1435,103 +2183,39 @@ void Isotope::loadXS() {
  */
 void Isotope::loadXS(char* xs_type) {
 
-    std::string directory = getXSLibDirectory();
-    std::string filename;
-    struct stat buffer;
     float* energies;
     float* xs_values;
+    int num_xs;
 
-    /* Set this isotope's appropriate cross-section using the data structures */
-    /********************************* ELASTIC ********************************/
-
-    if (!strcmp(xs_type, "elastic")) {
-
-        /* Check whether an elastic cross-section file exists for isotope */
-        filename = directory + _isotope_name + "-elastic.txt";
-
-	if (stat(filename.c_str(), &buffer))
-	    log_printf(ERROR, "Unable to load elastic xs for isotope %s"
-		       " since no data was found in the cross-section"
-		       " file %s for this isotope", 
-		       filename.c_str(), _isotope_name);
-
-	log_printf(INFO, "Loading %s-elastic.txt for isotope %s", 
-		   _isotope_name, _isotope_name);
-
-        /* Find the number of cross-section values in the file */
-	_num_elastic_xs = getNumCrossSectionDataPoints(filename.c_str());
-
-	/* Initialize data structures to store cross-section values */
-	energies = new float[_num_elastic_xs];
-	xs_values = new float[_num_elastic_xs];
-
-	/* Parse the file into the data structures */
-	parseCrossSections(filename.c_str(), energies, xs_values);
-
-	setElasticXS(xs_values, energies, _num_elastic_xs);
-    }
-
-
-    /********************************** CAPTURE *******************************/
-    if (!strcmp(xs_type, "capture")) {
+    if (strcmp(xs_type, "elastic") && strcmp(xs_type, "capture") && 
+        strcmp(xs_type, "fission"))
+        log_printf(ERROR, "Unable to load %s xs for isotope %s since only "
+                   "elastic, capture and fission cross-sections may be "
+                   "loaded", xs_type, _isotope_name);
 
-        /* Check whether a capture cross-section file exists for isotope */
-	filename = directory + _isotope_name + "-capture.txt";
+    /* Check whether cross-section data exists for this isotope */
+    num_xs = loadCrossSections(_isotope_name, xs_type, &energies, &xs_values);
 
-	if (stat(filename.c_str(), &buffer))
-	    log_printf(ERROR, "Unable to load capture xs for isotope %s"
-		       " since no data was found in the cross-section"
-		       " file %s for this isotope", 
-                       filename.c_str(), _isotope_name); 
+    if (num_xs == 0)
+        log_printf(ERROR, "Unable to load %s xs for isotope %s"
+                   " since no data was found in the cross-section"
+                   " library directory %s", xs_type, _isotope_name, 
+                   getXSLibDirectory());
 
-	log_printf(INFO, "Loading %s-capture.txt for isotope %s", 
-				    _isotope_name, _isotope_name);
-
-	/* Find the number of cross-section values in the file */
-	_num_capture_xs = getNumCrossSectionDataPoints(filename.c_str());
-
-	/* Initialize data structures to store cross-section values */
-	energies = new float[_num_capture_xs];
-	xs_values = new float[_num_capture_xs];
-
-	/* Parse the file into the data structures */
-	parseCrossSections(filename.c_str(), energies, xs_values);
-
-	setCaptureXS(xs_values, energies, _num_capture_xs);
-    }
-
-
-    /********************************* FISSION ********************************/
-    if (!strcmp(xs_type, "fission")) {
-
-        /* Check whether a fission cross-section file exists for isotope */
-	filename = directory + _isotope_name + "-fission.txt";
-
-	if (stat(filename.c_str(), &buffer))
-	    log_printf(ERROR, "Unable to load fission xs for isotope %s"
-		       " since no data was found in the cross-section"
-		       " file %s for this isotope", 
-                       filename.c_str(), _isotope_name); 
-
-	log_printf(INFO, "Loading %s-fission.txt for isotope %s", 
-					    _isotope_name, _isotope_name);
-
-	/* Find the number of cross-section values in the file */
-	_num_fission_xs = getNumCrossSectionDataPoints(filename.c_str());
-
-	/* Initialize data structures to store cross-section values */
-	energies = new float[_num_fission_xs];
-	xs_values = new float[_num_fission_xs];
+    /* Set this isotope's appropriate cross-section using the data structures */
+    if (!strcmp(xs_type, "elastic"))
+	setElasticXS(xs_values, energies, num_xs);
 
-	/* Parse the file into the data structures */
-	parseCrossSections(filename.c_str(), energies, xs_values);
+    else if (!strcmp(xs_type, "capture"))
+	setCaptureXS(xs_values, energies, num_xs);
 
-	setFissionXS(xs_values, energies, _num_fission_xs);
+    else {
+	setFissionXS(xs_values, energies, num_xs);
 	makeFissionable();
     }
     
     /* Rescale the cross-sections onto a uniform lethargy grid */
-    rescaleXS(pow(10., _start_lethargy), pow(10., _end_lethargy), _num_energies);
+    updateRescaledXS();
 
     return;
 }
@@ -1550,6 +2234,12 @@ void Isotope::setElasticXS(float* elastic_xs, float* elastic_xs_energies,
     _elastic_xs_energies = elastic_xs_energies;
     _num_elastic_xs = num_elastic_xs;
     _elastic_rescaled = false;
+    _xs_revision = ++_last_xs_revision;
+
+    if (_compact_elastic_xs != NULL) {
+        delete _compact_elastic_xs;
+        _compact_elastic_xs = NULL;
+    }
 }
 
 
@@ -1565,6 +2255,12 @@ void Isotope::setCaptureXS(float* capture_xs, float* capture_xs_energies,
     _capture_xs_energies = capture_xs_energies;
     _num_capture_xs = num_capture_xs;
     _capture_rescaled = false;
+    _xs_revision = ++_last_xs_revision;
+
+    if (_compact_capture_xs != NULL) {
+        delete _compact_capture_xs;
+        _compact_capture_xs = NULL;
+    }
 }
 
 
@@ -1580,14 +2276,37 @@ void Isotope::setFissionXS(float* fission_xs, float* fission_xs_energies,
     _fission_xs_energies = fission_xs_energies;
     _num_fission_xs = num_fission_xs;
     _fission_rescaled = false;
+    _xs_revision = ++_last_xs_revision;
+
+    if (_compact_fission_xs != NULL) {
+        delete _compact_fission_xs;
+        _compact_fission_xs = NULL;
+    }
+}
+
+/**
+ * @brief Rescales any cross-sections which have been set since they were
+ *        last rescaled, unless a cross-section update is in progress.
+ */
+void Isotope::updateRescaledXS() {
+
+    if (_updating_xs)
+        return;
+
+    rescaleXS(pow(10., _start_lethargy), pow(10., _end_lethargy), 
+              _num_energies);
 }
 
+
 /**
  * @brief Rescales all of the isotope's cross-sections onto a uniform
  *        lethargy grid.
  * @details Cross-section rescaling is useful because it allows for a fast
  *          O(1) table lookup (and linear interpolation) to compute 
- *          cross-section values for any given energy.
+ *          cross-section values for any given energy. Each cross-section 
+ *          which is not yet on the grid is resampled in a single sorted 
+ *          sweep over its energies and the grid, and the channels are 
+ *          resampled in parallel.
  * @param start_energy the highest lethargy value in the grid
  * @param end_energy the lowest lethargy value in the grid
  * @param num_energies the number of energies represented in the grid
@@ -1595,70 +2314,30 @@ void Isotope::setFissionXS(float* fission_xs, float* fission_xs_energies,
 void Isotope::rescaleXS(float start_energy, float end_energy,
 			int num_energies) {
 
-    float* grid;
-    float* new_energies;
-    float* new_xs;
-
-    _capture_rescaled = false;
-    _elastic_rescaled = false;
-    _fission_rescaled = false;
-
     /* Compute the uniform lethargy grid */
-    grid = logspace<float, float>(start_energy, end_energy, num_energies);
-
-    /* Capture xs */
-    if (_num_capture_xs != 0) {
-
-        new_energies = new float[num_energies];
-	memcpy(new_energies, grid, sizeof(float)*num_energies);
-	new_xs = new float[num_energies];
-
-	for (int i=0; i < num_energies; i++)
-	    new_xs[i] = getCaptureXS(new_energies[i]);
-
-	_num_capture_xs = num_energies;
-	delete [] _capture_xs_energies;
-	delete [] _capture_xs;
-	_capture_xs = new_xs;
-	_capture_xs_energies = new_energies;
-    }
-
-    /* Elastic xs */
-    if (_num_elastic_xs != 0) {
-	new_energies = new float[num_energies];
-	memcpy(new_energies, grid, sizeof(float)*num_energies);
-	new_xs = new float[num_energies];
-
-	for (int i=0; i < num_energies; i++)
-	  new_xs[i] = getElasticXS(grid[i]);
-
-	_num_elastic_xs = num_energies;
-	delete [] _elastic_xs_energies;
-	delete [] _elastic_xs;
-	_elastic_xs = new_xs;
-	_elastic_xs_energies = new_energies;
-    }
-
-    /* Fission xs */
-    if (_num_fission_xs != 0) {
-	new_energies = new float[num_energies];
-	memcpy(new_energies, grid, sizeof(float)*num_energies);
-	new_xs = new float[num_energies];
-
-	for (int i=0; i < num_energies; i++)
-   	    new_xs[i] = getFissionXS(new_energies[i]);
-
-	_num_fission_xs = num_energies;
-	delete [] _fission_xs_energies;
-	delete [] _fission_xs;
-	_fission_xs = new_xs;
-	_fission_xs_energies = new_energies;
+    float* grid = logspace<float, float>(start_energy, end_energy, 
+                                         num_energies);
+
+    /* Cross-sections which are already on the uniform lethargy grid need 
+     * not be rescaled again */
+    #pragma omp parallel sections
+    {
+        #pragma omp section
+        if (_num_capture_xs != 0 && !_capture_rescaled)
+            rescaleXS(grid, num_energies, &_capture_xs, 
+                      &_capture_xs_energies, &_num_capture_xs);
+
+        #pragma omp section
+        if (_num_elastic_xs != 0 && !_elastic_rescaled)
+            rescaleXS(grid, num_energies, &_elastic_xs, 
+                      &_elastic_xs_energies, &_num_elastic_xs);
+
+        #pragma omp section
+        if (_num_fission_xs != 0 && !_fission_rescaled)
+            rescaleXS(grid, num_energies, &_fission_xs, 
+                      &_fission_xs_energies, &_num_fission_xs);
     }
 
-    /* Compute absorption and total cross-sections */
-    generateAbsorptionXS(start_energy, end_energy, num_energies);
-    generateTotalXS(start_energy, end_energy, num_energies);
-
     /* Assign values for uniform lethargy grid parameters useful
      * for computing indices into the grid at a given energy */
     _start_lethargy = log10(start_energy);
@@ -1668,6 +2347,13 @@ void Isotope::rescaleXS(float start_energy, float end_energy,
     _elastic_rescaled = true;
     _fission_rescaled = true;
 
+    /* Compute absorption and total cross-sections */
+    generateDerivedXS(grid, num_energies);
+
+    /* Encode the rescaled cross-sections in a 16-bit format if needed */
+    compactXS();
+    _xs_revision = ++_last_xs_revision;
+
     delete [] grid;
 
     return;
@@ -1675,67 +2361,135 @@ void Isotope::rescaleXS(float start_energy, float end_energy,
 
 
 /**
- * @brief Computes the microscopic absorption cross-section from 
- *        the isotope's capture and fission (if applicable) cross-sections.
- * @details This class method computes the absorption cross-section
- *          on a uniform lethargy grid.
- * @param start_energy the highest lethargy value in the grid
- * @param end_energy the lowest lethargy value in the grid
- * @param num_energies the number of energies represented in the grid
+ * @brief Resamples a single cross-section onto a uniform lethargy grid.
+ * @details The cross-section arrays are replaced by newly allocated arrays
+ *          on the grid and the old arrays are deleted.
+ * @param grid the energies (eV) of the uniform lethargy grid
+ * @param num_energies the number of energies in the grid
+ * @param xs a pointer to the array of cross-section values
+ * @param xs_energies a pointer to the array of cross-section energies (eV)
+ * @param num_xs a pointer to the number of cross-section values
  */
-void Isotope::generateAbsorptionXS(float start_energy, float end_energy, 
-				   int num_energies) {
+void Isotope::rescaleXS(float* grid, int num_energies, float** xs, 
+                        float** xs_energies, int* num_xs) {
 
-    /* Generate an absorption xs on the uniform energy/lethargy grid */
-    float* new_energies = logspace<float, float>(start_energy, 
-						 end_energy, num_energies);
+    float* new_energies = new float[num_energies];
     float* new_xs = new float[num_energies];
 
+    memcpy(new_energies, grid, sizeof(float)*num_energies);
+    linearInterpSorted<float, float, float>(*xs_energies, *xs, *num_xs, 
+                                            grid, new_xs, num_energies);
+
+    delete [] *xs_energies;
+    delete [] *xs;
+    *xs = new_xs;
+    *xs_energies = new_energies;
+    *num_xs = num_energies;
+}
+
+
+/**
+ * @brief Computes the microscopic absorption and total cross-sections from
+ *        the isotope's capture, elastic scatter and fission (if applicable)
+ *        cross-sections.
+ * @details This class method computes the absorption and total 
+ *          cross-sections on a uniform lethargy grid in a single pass over
+ *          the rescaled cross-sections.
+ * @param grid the energies (eV) of the uniform lethargy grid
+ * @param num_energies the number of energies represented in the grid
+ */
+void Isotope::generateDerivedXS(float* grid, int num_energies) {
+
+    /* Free memory for the old absorption and total xs */
+    if (_num_absorb_xs != 0) {
+        delete [] _absorb_xs;
+        delete [] _absorb_xs_energies;
+    }
+
+    if (_num_total_xs != 0) {
+        delete [] _total_xs;
+        delete [] _total_xs_energies;
+    }
+
     _num_absorb_xs = num_energies;
+    _num_total_xs = num_energies;
+    _absorb_xs = new float[num_energies];
+    _absorb_xs_energies = new float[num_energies];
+    _total_xs = new float[num_energies];
+    _total_xs_energies = new float[num_energies];
 
-    if (_fissionable)
-        for (int i=0; i < num_energies; i++)
-	    new_xs[i] = getCaptureXS(new_energies[i]) +                                                  getFissionXS(new_energies[i]);
+    memcpy(_absorb_xs_energies, grid, sizeof(float)*num_energies);
+    memcpy(_total_xs_energies, grid, sizeof(float)*num_energies);
 
-    else
-        for (int i=0; i < num_energies; i++)
-	    new_xs[i] = getCaptureXS(new_energies[i]);
+    bool has_capture = (_num_capture_xs != 0);
+    bool has_elastic = (_num_elastic_xs != 0);
+    bool has_fission = (_fissionable && _num_fission_xs != 0);
 
+    #pragma omp parallel for
+    for (int i=0; i < num_energies; i++) {
 
-    _absorb_xs = new_xs;
-    _absorb_xs_energies = new_energies;
+        float absorb_xs = 0.0;
 
-    return;
+        if (has_capture)
+            absorb_xs += _capture_xs[i];
+        if (has_fission)
+            absorb_xs += _fission_xs[i];
+
+        _absorb_xs[i] = absorb_xs;
+        _total_xs[i] = absorb_xs;
+
+        if (has_elastic)
+            _total_xs[i] += _elastic_xs[i];
+    }
+
+    _rescaled = true;
 }
 
 
 /**
- * @brief Computes the microscopic total cross-section from the isotope's
- *        capture, elastic scatter and fission (if applicable) cross-sections.
- * @details This class method computes the total cross-section
- *          on a uniform lethargy grid.
- * @param start_energy the highest lethargy value in the grid
- * @param end_energy the lowest lethargy value in the grid
- * @param num_energies the number of energies represented in the grid
+ * @brief Encodes the isotope's rescaled cross-sections in the 16-bit format
+ *        set for this isotope, if any.
  */
-void Isotope::generateTotalXS(float start_energy, float end_energy, 
-			      int num_energies) {
+void Isotope::compactXS() {
 
-    /* Generate a total xs on the uniform energy/lethargy grid */
-    float* new_energies = logspace<float, float>(start_energy, 
-						end_energy, num_energies);
-    float* new_xs = new float[num_energies];
+    clearCompactXS();
 
-    _num_total_xs = num_energies;
+    if (_xs_precision == FLOAT32_XS)
+        return;
 
-    for (int i=0; i < num_energies; i++)
-	new_xs[i] = getAbsorptionXS(new_energies[i]) + 
-                    getElasticXS(new_energies[i]);
+    if (_num_elastic_xs != 0 && _elastic_rescaled)
+        _compact_elastic_xs = new CompactXS(_elastic_xs, _num_elastic_xs,
+                                            _xs_precision);
+    if (_num_capture_xs != 0 && _capture_rescaled)
+        _compact_capture_xs = new CompactXS(_capture_xs, _num_capture_xs,
+                                            _xs_precision);
+    if (_num_fission_xs != 0 && _fission_rescaled)
+        _compact_fission_xs = new CompactXS(_fission_xs, _num_fission_xs,
+                                            _xs_precision);
+    if (_num_absorb_xs != 0)
+        _compact_absorb_xs = new CompactXS(_absorb_xs, _num_absorb_xs,
+                                           _xs_precision);
+    if (_num_total_xs != 0)
+        _compact_total_xs = new CompactXS(_total_xs, _num_total_xs,
+                                          _xs_precision);
+}
 
-    _total_xs = new_xs;
-    _total_xs_energies = new_energies;
 
-    _rescaled = true;
+/**
+ * @brief Deletes the 16-bit copies of the isotope's cross-sections.
+ */
+void Isotope::clearCompactXS() {
+
+    CompactXS** compact_xs[5] = {&_compact_elastic_xs, &_compact_capture_xs,
+                                 &_compact_fission_xs, &_compact_absorb_xs,
+                                 &_compact_total_xs};
+
+    for (int i=0; i < 5; i++) {
+        if (*compact_xs[i] != NULL) {
+            delete *compact_xs[i];
+            *compact_xs[i] = NULL;
+        }
+    }
 }
 
 
@@ -1755,6 +2509,34 @@ Isotope* Isotope::clone() {
     new_clone->setA(_A);
     new_clone->setTemperature(_T);
 
+    /* Copy the temperature tables */
+    for (int i=0; i < (int)_xs_temperatures.size(); i++) {
+        new_clone->_xs_temperatures.push_back(_xs_temperatures[i]);
+        new_clone->_elastic_xs_tables.push_back(new float[_num_energies]);
+        new_clone->_capture_xs_tables.push_back(new float[_num_energies]);
+        new_clone->_fission_xs_tables.push_back(new float[_num_energies]);
+        new_clone->_absorb_xs_tables.push_back(new float[_num_energies]);
+        new_clone->_total_xs_tables.push_back(new float[_num_energies]);
+
+        memcpy(new_clone->_elastic_xs_tables[i], _elastic_xs_tables[i], 
+               sizeof(float)*_num_energies);
+        memcpy(new_clone->_capture_xs_tables[i], _capture_xs_tables[i], 
+               sizeof(float)*_num_energies);
+        memcpy(new_clone->_fission_xs_tables[i], _fission_xs_tables[i], 
+               sizeof(float)*_num_energies);
+        memcpy(new_clone->_absorb_xs_tables[i], _absorb_xs_tables[i], 
+               sizeof(float)*_num_energies);
+        memcpy(new_clone->_total_xs_tables[i], _total_xs_tables[i], 
+               sizeof(float)*_num_energies);
+    }
+
+    new_clone->setTemperatureInterpolation(_temperature_interp);
+    new_clone->setXSPrecision(_xs_precision);
+
+    /* Copy the multipole representation */
+    if (_multipole != NULL)
+        new_clone->_multipole = _multipole->clone();
+
     /* Return a pointer to the cloned Isotope class */
     return new_clone;
 }
@@ -1768,19 +2550,20 @@ Isotope* Isotope::clone() {
 void Isotope::sampleCollisionType(neutron* neutron) {
 
     float energy = neutron->_energy;
+    float temperature = neutron->_temperature;
     float test = float(rand()) / RAND_MAX;
     float collision_xs = 0.0;
     float prev_collision_xs = 0.0;
-    float total_xs = getTotalXS(energy);
+    float total_xs = getTotalXS(energy, temperature);
 
     /* Elastic scatter collision */
-    collision_xs += getElasticXS(energy) / total_xs;
+    collision_xs += getElasticXS(energy, temperature) / total_xs;
     if (test >= prev_collision_xs && test <= collision_xs)
         return;
 
     /* Capture collision */
     prev_collision_xs = collision_xs;
-    collision_xs += getCaptureXS(energy) / total_xs;    
+    collision_xs += getCaptureXS(energy, temperature) / total_xs;
     if (test >= prev_collision_xs && test <= collision_xs) {
         neutron->_alive = false;
 	return;
@@ -2125,7 +2908,7 @@ float Isotope::getDistanceTraveled(neutron* neutron) {
     double random;
     double distance;
 
-    sigma_a = getTotalXS(neutron->_energy);
+    sigma_a = getTotalXS(neutron->_energy, neutron->_temperature);
     random = (float)(rand()) / (float)(RAND_MAX);
     distance = - log(random) / sigma_a;
 
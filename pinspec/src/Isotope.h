@@ -30,8 +30,60 @@
 #include "log.h"
 #include "vector.h"
 #include "Neutron.h"
+#include "Multipole.h"
+#include "CompactXS.h"
 #endif
 
+
+/**
+ * @enum temperatureInterpTypes
+ * @brief The schemes for interpolating cross-sections between tables
+ *        at different temperatures.
+ */
+
+/**
+ * @var temperatureInterpType
+ * @brief A scheme for interpolating cross-sections between tables at 
+ *        different temperatures.
+ */
+typedef enum temperatureInterpTypes {
+    /** Linear interpolation in temperature */
+    LINEAR_TEMPERATURE,
+    /** Linear interpolation in the square root of temperature */
+    SQRT_TEMPERATURE
+} temperatureInterpType;
+
+
+/**
+ * @enum xsTypes
+ * @brief The types of cross-sections
+ */
+
+/**
+ * @var xsType
+ * @brief A type of cross-section
+ */
+typedef enum xsTypes {
+    /** The elastic scattering cross-section */
+    ELASTIC_XS,
+    /** The capture cross-section */
+    CAPTURE_XS,
+    /** The fission cross-section */
+    FISSION_XS,
+    /** The absorption cross-section */
+    ABSORPTION_XS,
+    /** The total cross-section */
+    TOTAL_XS,
+    /** The transport cross-section */
+    TRANSPORT_XS,
+    /** An unknown type of cross-section */
+    UNKNOWN_XS
+} xsType;
+
+/** The number of types of cross-sections */
+#define NUM_XS_TYPES 6
+
+
 /**
  * @class Isotope Isotope.h "pinspec/src/Isotope.h"
  * @brief The Isotope represents a nuclide at some temperature.
@@ -46,6 +98,12 @@ private:
     static int _n;
     /** The isotope's unique identifier */
     int _uid;
+    /** A static class variable for the most recent cross-section revision
+     *  of any isotope */
+    static int _last_xs_revision;
+    /** The revision of the isotope's cross-sections, which is renewed 
+     *  whenever they change */
+    int _xs_revision;
     /** Atomic number */
     int _A;
     /** Atomic number squared (an optimization for speedup) */
@@ -70,6 +128,9 @@ private:
     bool _fissionable;
     /** Whether cross-sections are rescaled on uniform lethargy grid */
     bool _rescaled;
+    /** Whether rescaling is deferred until the current cross-section update
+     *  is committed */
+    bool _updating_xs;
 
     /** The number of elastic scattering cross-section data points */
     int _num_elastic_xs;
@@ -144,6 +205,50 @@ private:
     /** Array of \f$ \frac{E}{E'} \f$ for each PDF/CDF */
     float* _Eprime_to_E;
 
+    /** The temperatures (K) of the pre-broadened cross-section tables in
+     * ascending order */
+    std::vector<float> _xs_temperatures;
+    /** Elastic scattering cross-section tables on the uniform lethargy grid
+     * for each temperature */
+    std::vector<float*> _elastic_xs_tables;
+    /** Capture cross-section tables on the uniform lethargy grid for each
+     * temperature */
+    std::vector<float*> _capture_xs_tables;
+    /** Fission cross-section tables on the uniform lethargy grid for each
+     * temperature */
+    std::vector<float*> _fission_xs_tables;
+    /** Absorption cross-section tables on the uniform lethargy grid for each
+     * temperature */
+    std::vector<float*> _absorb_xs_tables;
+    /** Total cross-section tables on the uniform lethargy grid for each
+     * temperature */
+    std::vector<float*> _total_xs_tables;
+    /** The scheme used to interpolate between temperature tables */
+    temperatureInterpType _temperature_interp;
+
+    /** The windowed multipole representation of the resolved resonances,
+     *  or NULL if the tabulated cross-sections are used at all energies */
+    Multipole* _multipole;
+
+    /** The format used to store the cross-sections on the uniform lethargy
+     *  grid for lookups */
+    xsPrecision _xs_precision;
+    /** The elastic scattering cross-section in a 16-bit format, or NULL if 
+     *  it is stored as 32-bit floats */
+    CompactXS* _compact_elastic_xs;
+    /** The capture cross-section in a 16-bit format, or NULL if it is 
+     *  stored as 32-bit floats */
+    CompactXS* _compact_capture_xs;
+    /** The fission cross-section in a 16-bit format, or NULL if it is 
+     *  stored as 32-bit floats */
+    CompactXS* _compact_fission_xs;
+    /** The absorption cross-section in a 16-bit format, or NULL if it is 
+     *  stored as 32-bit floats */
+    CompactXS* _compact_absorb_xs;
+    /** The total cross-section in a 16-bit format, or NULL if it is stored
+     *  as 32-bit floats */
+    CompactXS* _compact_total_xs;
+
     void loadXS();
     void setElasticXS(float* elastic_xs, float* elastic_xs_energies,								   int num_elastic_xs);
     void setCaptureXS(float* capture_xs, float* capture_xs_energies,
@@ -151,14 +256,18 @@ private:
     void setFissionXS(float* fission_xs, float* fission_xs_energies,
 			                          int num_fission_xs);
     void rescaleXS(float start_energy, float end_energy, int num_energies);
-    void generateAbsorptionXS(float start_energy, float end_energy, 
-			      int num_energies);
-    void generateTotalXS(float start_energy, float end_energy, 
-			 int num_energies);
+    void rescaleXS(float* grid, int num_energies, float** xs, 
+                   float** xs_energies, int* num_xs);
+    void updateRescaledXS();
+    void generateDerivedXS(float* grid, int num_energies);
+    void compactXS();
+    void clearCompactXS();
 
     void initializeThermalScattering(float start_energy, float end_energy,
 					 int num_bins, int num_distributions);
     float thermalScatteringProb(float E_prime_to_E, int dist_index);
+    float interpolateTemperatureTables(const std::vector<float*>& tables,
+                                       float energy, float temperature) const;
 
 public:
     Isotope(char *_isotope_name);
@@ -177,6 +286,7 @@ public:
     float getThermalScatteringCutoff();
 
     int getNumXSEnergies(char* xs_type) const;
+    static xsType getXSType(char* xs_type);
 
     float getElasticXS(float energy) const;
     float getElasticXS(int energy_index) const;
@@ -191,15 +301,39 @@ public:
     float getTransportXS(int energy_index) const;
     float getTransportXS(float energy) const;
 
+    float getElasticXS(float energy, float temperature) const;
+    float getAbsorptionXS(float energy, float temperature) const;
+    float getCaptureXS(float energy, float temperature) const;
+    float getFissionXS(float energy, float temperature) const;
+    float getTotalXS(float energy, float temperature) const;
+    float getTransportXS(float energy, float temperature) const;
+    void evaluateXS(xsType type, float* energies, float* xs, 
+                    int num_energies, float temperature) const;
+
+    int getNumTemperatureTables() const;
+    temperatureInterpType getTemperatureInterpolation() const;
+    xsPrecision getXSPrecision() const;
+    float getXSPrecisionError(char* xs_type) const;
+
     bool usesThermalScattering();
+    bool usesMultipole() const;
+    Multipole* getMultipole() const;
     bool isRescaled() const;
+    int getXSRevision() const;
+    static int getLastXSRevision();
+    bool isUpdatingXS() const;
     int getEnergyGridIndex(float energy) const;
+    float getStartLethargy() const;
+    float getEndLethargy() const;
+    float getDeltaLethargy() const;
 
-    /* IMPORTANT: The following eight class method prototypes must
+    /* IMPORTANT: The following nine class method prototypes must
      *  not be changed without changing Geometry.i to allow for the 
      * data arrays to be transformed into numpy arrays */
     void retrieveXSEnergies(float* energies, int num_xs, char* xs_type) const;
     void retrieveXS(float* xs, int num_xs, char* xs_type) const;
+    void evaluateXS(double* energies, int num_energies, float* xs, 
+                    int num_xs, char* xs_type) const;
 
     void setElasticXS(double* energies, int num_energies,
                        double* elastic_xs, int num_xs);
@@ -217,11 +351,20 @@ public:
 
 
     void loadXS(char* xs_type);
+    void beginXSUpdate();
+    void commitXSUpdate();
     void setA(int A);
     void setTemperature(float T);
     void neglectThermalScattering();
     void setThermalScatteringCutoff(float cutoff_energy);
     void useThermalScattering();
+    void addTemperatureTable(float temperature);
+    void clearTemperatureTables();
+    void setTemperatureInterpolation(temperatureInterpType interp);
+    void setXSPrecision(xsPrecision precision);
+    void useMultipole(int num_windows=1000, float energy_min=1.0, 
+                      float energy_max=0.0);
+    void neglectMultipole();
 
     Isotope* clone();
 
@@ -239,6 +382,18 @@ public:
 };
 
 
+/**
+ * @brief Returns the most recent cross-section revision of any isotope.
+ * @details This changes whenever the cross-sections of any isotope change,
+ *          such that data derived from the cross-sections of many isotopes
+ *          is known to be up to date in constant time while it is the same.
+ * @return the most recent cross-section revision
+ */
+inline int Isotope::getLastXSRevision() {
+    return _last_xs_revision;
+}
+
+
 /**
  * @brief This method returns the index for a certain energy (eV) into
  *        the Isotope's uniform lethargy grid.
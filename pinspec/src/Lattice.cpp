@@ -0,0 +1,487 @@
+#include "Lattice.h"
+
+
+/**
+ * @brief Universe constructor.
+ * @param universe_name the name of the universe
+ */
+Universe::Universe(const char* universe_name) {
+
+    int length = strlen(universe_name);
+    _universe_name = new char[length+1];
+
+    for (int i=0; i <= length; i++)
+        _universe_name[i] = universe_name[i];
+}
+
+
+/**
+ * @brief Universe destructor lets SWIG delete the regions during garbage
+ *        collection.
+ */
+Universe::~Universe() {
+    delete [] _universe_name;
+}
+
+
+/**
+ * @brief Returns the name of the universe.
+ * @return a character array representing the universe's name
+ */
+char* Universe::getName() {
+    return _universe_name;
+}
+
+
+/**
+ * @brief Returns the number of regions in the universe.
+ * @return the number of regions
+ */
+int Universe::getNumRegions() {
+    return _regions.size();
+}
+
+
+/**
+ * @brief Returns a region in the universe.
+ * @param index the index of the region in the order it was added
+ * @return a pointer to the region
+ */
+BoundedRegion* Universe::getRegion(int index) {
+
+    if (index < 0 || index >= int(_regions.size())) {
+        log_printf(ERROR, "Unable to get region %d from universe %s which "
+                   "has %d regions", index, _universe_name,
+                   int(_regions.size()));
+        return NULL;
+    }
+
+    return _regions[index];
+}
+
+
+/**
+ * @brief Returns the regions in the universe.
+ * @return a reference to the container of regions
+ */
+std::vector<BoundedRegion*>& Universe::getRegions() {
+    return _regions;
+}
+
+
+/**
+ * @brief Adds a region to the universe.
+ * @param region a pointer to the region
+ */
+void Universe::addRegion(BoundedRegion* region) {
+    _regions.push_back(region);
+}
+
+
+/**
+ * @brief Finds the region in the universe containing a neutron.
+ * @details The regions are tested in the order they were added to the
+ *          universe.
+ * @param neutron the neutron of interest in the local coordinates
+ * @return a pointer to the region, or NULL if no region was found
+ */
+BoundedRegion* Universe::findRegion(neutron* neutron) {
+
+    std::vector<BoundedRegion*>::iterator iter;
+    for (iter = _regions.begin(); iter != _regions.end(); ++iter) {
+        if ((*iter)->contains(neutron))
+            return (*iter);
+    }
+
+    return NULL;
+}
+
+
+/**
+ * @brief Finds the region in the universe containing a point.
+ * @details The regions are tested in the order they were added to the
+ *          universe.
+ * @param x the x-coordinate of interest in the local coordinates
+ * @param y the y-coordinate of interest in the local coordinates
+ * @param z the z-coordinate of interest
+ * @return a pointer to the region, or NULL if no region was found
+ */
+BoundedRegion* Universe::findRegion(float x, float y, float z) {
+
+    std::vector<BoundedRegion*>::iterator iter;
+    for (iter = _regions.begin(); iter != _regions.end(); ++iter) {
+        if ((*iter)->contains(x, y, z))
+            return (*iter);
+    }
+
+    return NULL;
+}
+
+
+/**
+ * @brief Lattice constructor.
+ * @details The lattice is centered on the origin and each of its cells is
+ *          empty until it is filled with a universe.
+ * @param num_x the number of cells along the x-axis
+ * @param num_y the number of cells along the y-axis
+ * @param width_x the width of each cell along the x-axis (cm)
+ * @param width_y the width of each cell along the y-axis (cm)
+ * @param lattice_name the name of the lattice
+ */
+Lattice::Lattice(int num_x, int num_y, float width_x, float width_y,
+                 const char* lattice_name) {
+
+    int length = strlen(lattice_name);
+    _lattice_name = new char[length+1];
+
+    for (int i=0; i <= length; i++)
+        _lattice_name[i] = lattice_name[i];
+
+    if (num_x < 1 || num_y < 1 || width_x <= 0.0 || width_y <= 0.0)
+        log_printf(ERROR, "Unable to create lattice %s with %d x %d cells of "
+                   "width %f x %f cm since there must be at least one cell "
+                   "of positive width", _lattice_name, num_x, num_y,
+                   width_x, width_y);
+
+    _num_x = num_x;
+    _num_y = num_y;
+    _width_x = width_x;
+    _width_y = width_y;
+    _x_min = -num_x * width_x / 2.0;
+    _y_min = -num_y * width_y / 2.0;
+    _universes.resize(num_x * num_y, NULL);
+
+    XPlane* left = new XPlane();
+    XPlane* right = new XPlane();
+    YPlane* bottom = new YPlane();
+    YPlane* top = new YPlane();
+
+    left->setX(_x_min);
+    right->setX(-_x_min);
+    bottom->setY(_y_min);
+    top->setY(-_y_min);
+
+    _boundary_surfaces[0] = left;
+    _boundary_surfaces[1] = right;
+    _boundary_surfaces[2] = bottom;
+    _boundary_surfaces[3] = top;
+
+    setBoundaryType(REFLECTIVE);
+}
+
+
+/**
+ * @brief Lattice destructor deletes the surfaces bounding the lattice.
+ */
+Lattice::~Lattice() {
+
+    delete [] _lattice_name;
+
+    for (int i=0; i < 4; i++)
+        delete _boundary_surfaces[i];
+}
+
+
+/**
+ * @brief Returns the name of the lattice.
+ * @return a character array representing the lattice's name
+ */
+char* Lattice::getName() {
+    return _lattice_name;
+}
+
+
+/**
+ * @brief Returns the number of cells along the x-axis.
+ * @return the number of cells along the x-axis
+ */
+int Lattice::getNumX() {
+    return _num_x;
+}
+
+
+/**
+ * @brief Returns the number of cells along the y-axis.
+ * @return the number of cells along the y-axis
+ */
+int Lattice::getNumY() {
+    return _num_y;
+}
+
+
+/**
+ * @brief Returns the total number of cells in the lattice.
+ * @return the number of cells
+ */
+int Lattice::getNumCells() {
+    return _num_x * _num_y;
+}
+
+
+/**
+ * @brief Returns the width of each cell along the x-axis.
+ * @return the width of each cell along the x-axis (cm)
+ */
+float Lattice::getWidthX() {
+    return _width_x;
+}
+
+
+/**
+ * @brief Returns the width of each cell along the y-axis.
+ * @return the width of each cell along the y-axis (cm)
+ */
+float Lattice::getWidthY() {
+    return _width_y;
+}
+
+
+/**
+ * @brief Returns the boundary condition on the edges of the lattice.
+ * @return the boundary type (REFLECTIVE or VACUUM)
+ */
+boundaryType Lattice::getBoundaryType() {
+    return _boundary_surfaces[0]->getBoundaryType();
+}
+
+
+/**
+ * @brief Returns one of the surfaces bounding the lattice.
+ * @param index the index of the surface (0: left, 1: right, 2: bottom and
+ *        3: top)
+ * @return a pointer to the surface
+ */
+Surface* Lattice::getBoundarySurface(int index) {
+
+    if (index < 0 || index > 3) {
+        log_printf(ERROR, "Unable to get boundary surface %d of lattice %s "
+                   "since the index must be between 0 and 3", index,
+                   _lattice_name);
+        return NULL;
+    }
+
+    return _boundary_surfaces[index];
+}
+
+
+/**
+ * @brief Returns the universe filling a lattice cell.
+ * @param cell the index of the lattice cell
+ * @return a pointer to the universe, or NULL if the cell is empty
+ */
+Universe* Lattice::getUniverse(int cell) {
+    return _universes[cell];
+}
+
+
+/**
+ * @brief Returns each of the universes filling the lattice once, in the
+ *        order of the cells they first fill.
+ * @return a container of the universes
+ */
+std::vector<Universe*> Lattice::getUniqueUniverses() {
+
+    std::vector<Universe*> universes;
+    std::set<Universe*> found;
+
+    for (int i=0; i < int(_universes.size()); i++) {
+        if (_universes[i] != NULL && found.insert(_universes[i]).second)
+            universes.push_back(_universes[i]);
+    }
+
+    return universes;
+}
+
+
+/**
+ * @brief Returns each of the regions in the universes filling the lattice
+ *        once.
+ * @return a container of the regions
+ */
+std::vector<BoundedRegion*> Lattice::getRegions() {
+
+    std::vector<BoundedRegion*> regions;
+    std::set<BoundedRegion*> found;
+    std::vector<Universe*> universes = getUniqueUniverses();
+
+    for (int i=0; i < int(universes.size()); i++) {
+        for (int j=0; j < universes[i]->getNumRegions(); j++) {
+            BoundedRegion* region = universes[i]->getRegion(j);
+            if (found.insert(region).second)
+                regions.push_back(region);
+        }
+    }
+
+    return regions;
+}
+
+
+/**
+ * @brief Sets the boundary condition on the edges of the lattice.
+ * @param type the boundary type (REFLECTIVE or VACUUM)
+ */
+void Lattice::setBoundaryType(boundaryType type) {
+
+    if (type == INTERFACE) {
+        log_printf(ERROR, "Unable to set an INTERFACE boundary condition for "
+                   "lattice %s since it must be REFLECTIVE or VACUUM",
+                   _lattice_name);
+        return;
+    }
+
+    for (int i=0; i < 4; i++)
+        _boundary_surfaces[i]->setBoundaryType(type);
+}
+
+
+/**
+ * @brief Fills a lattice cell with a universe.
+ * @param i the index of the cell along the x-axis
+ * @param j the index of the cell along the y-axis
+ * @param universe a pointer to the universe
+ */
+void Lattice::setUniverse(int i, int j, Universe* universe) {
+
+    if (i < 0 || i >= _num_x || j < 0 || j >= _num_y) {
+        log_printf(ERROR, "Unable to set the universe for cell (%d, %d) of "
+                   "lattice %s which has %d x %d cells", i, j, _lattice_name,
+                   _num_x, _num_y);
+        return;
+    }
+
+    _universes[getCell(i, j)] = universe;
+}
+
+
+/**
+ * @brief Fills each of the lattice cells with the same universe.
+ * @param universe a pointer to the universe
+ */
+void Lattice::fillUniverse(Universe* universe) {
+    std::fill(_universes.begin(), _universes.end(), universe);
+}
+
+
+/**
+ * @brief Moves a neutron from global coordinates into the local coordinates
+ *        of the lattice cell containing it.
+ * @details A neutron on or just beyond an edge of the lattice is placed in 
+ *          the nearest cell.
+ * @param neutron the neutron of interest
+ */
+void Lattice::toLocalCoords(neutron* neutron) {
+
+    int i = int(floor((neutron->_x - _x_min) / _width_x));
+    int j = int(floor((neutron->_y - _y_min) / _width_y));
+
+    i = std::max(0, std::min(_num_x - 1, i));
+    j = std::max(0, std::min(_num_y - 1, j));
+
+    neutron->_cell = getCell(i, j);
+    neutron->_x -= getCellCenterX(neutron->_cell);
+    neutron->_y -= getCellCenterY(neutron->_cell);
+}
+
+
+/**
+ * @brief Moves a neutron from the local coordinates of its lattice cell into
+ *        global coordinates.
+ * @param neutron the neutron of interest
+ */
+void Lattice::toGlobalCoords(neutron* neutron) {
+    neutron->_x += getCellCenterX(neutron->_cell);
+    neutron->_y += getCellCenterY(neutron->_cell);
+}
+
+
+/**
+ * @brief Applies the boundary condition to a neutron which crossed an edge 
+ *        of the lattice.
+ * @details A neutron which crossed an edge of a REFLECTIVE lattice is moved
+ *          back to its mirror image across the edge and the component of its
+ *          direction normal to the edge is reversed, which is the same as 
+ *          reflecting it at the edge. A neutron which crossed an edge of a 
+ *          VACUUM lattice is killed. The neutron is in the local coordinates
+ *          of its lattice cell.
+ * @param neutron the neutron of interest
+ */
+void Lattice::applyBoundaryCondition(neutron* neutron) {
+
+    int i = neutron->_cell % _num_x;
+    int j = neutron->_cell / _num_x;
+    float half_width_x = _width_x / 2.0;
+    float half_width_y = _width_y / 2.0;
+    bool crossed = false;
+
+    if (i == _num_x - 1 && neutron->_x > half_width_x) {
+        neutron->_x = _width_x - neutron->_x;
+        neutron->_u = -neutron->_u;
+        crossed = true;
+    }
+    else if (i == 0 && neutron->_x < -half_width_x) {
+        neutron->_x = -_width_x - neutron->_x;
+        neutron->_u = -neutron->_u;
+        crossed = true;
+    }
+
+    if (j == _num_y - 1 && neutron->_y > half_width_y) {
+        neutron->_y = _width_y - neutron->_y;
+        neutron->_v = -neutron->_v;
+        crossed = true;
+    }
+    else if (j == 0 && neutron->_y < -half_width_y) {
+        neutron->_y = -_width_y - neutron->_y;
+        neutron->_v = -neutron->_v;
+        crossed = true;
+    }
+
+    if (crossed && getBoundaryType() == VACUUM)
+        neutron->_alive = false;
+}
+
+
+/**
+ * @brief Moves a neutron which crossed an edge of its lattice cell into the
+ *        local coordinates of the adjacent cell.
+ * @details The adjacent cell is found from the neutron's local coordinates,
+ *          which are exact with respect to the edges of the cell, such that
+ *          neutrons which cross an edge at a grazing angle are not lost to 
+ *          round-off as they would be if they were located again from their
+ *          global coordinates. A neutron within its cell is not moved.
+ * @param neutron the neutron of interest
+ * @return true if the neutron moved to another cell, otherwise false
+ */
+bool Lattice::updateCell(neutron* neutron) {
+
+    int i = neutron->_cell % _num_x;
+    int j = neutron->_cell / _num_x;
+    float half_width_x = _width_x / 2.0;
+    float half_width_y = _width_y / 2.0;
+    bool moved = false;
+
+    if (neutron->_x > half_width_x && i < _num_x - 1) {
+        neutron->_x -= _width_x;
+        i++;
+        moved = true;
+    }
+    else if (neutron->_x < -half_width_x && i > 0) {
+        neutron->_x += _width_x;
+        i--;
+        moved = true;
+    }
+
+    if (neutron->_y > half_width_y && j < _num_y - 1) {
+        neutron->_y -= _width_y;
+        j++;
+        moved = true;
+    }
+    else if (neutron->_y < -half_width_y && j > 0) {
+        neutron->_y += _width_y;
+        j--;
+        moved = true;
+    }
+
+    neutron->_cell = getCell(i, j);
+
+    return moved;
+}
@@ -0,0 +1,174 @@
+/**
+ * @file Lattice.h
+ * @brief The Universe and Lattice classes.
+ * @date October 18, 2026
+ */
+
+#ifndef LATTICE_H_
+#define LATTICE_H_
+
+#ifdef __cplusplus
+#include <vector>
+#include <set>
+#include <algorithm>
+#include <math.h>
+#include <string.h>
+#include "Region.h"
+#include "Surface.h"
+#include "log.h"
+#endif
+
+
+/**
+ * @class Universe Lattice.h "pinspec/src/Lattice.h"
+ * @brief A Universe is a collection of BoundedRegions which may be placed
+ *        in the cells of a Lattice.
+ * @details The surfaces bounding the regions of a Universe are defined in
+ *          the local coordinates of a lattice cell, with the origin at the
+ *          center of the cell. The regions must fill the lattice cell and
+ *          the outermost regions must be bounded by surfaces on the edges
+ *          of the cell. A Universe which is placed in many lattice cells
+ *          shares its regions, and the tallies of those regions, between
+ *          each of the cells.
+ */
+class Universe {
+
+protected:
+    /** The name of the universe */
+    char* _universe_name;
+    /** The regions in the universe */
+    std::vector<BoundedRegion*> _regions;
+
+public:
+    Universe(const char* universe_name=(char*)"");
+    virtual ~Universe();
+
+    char* getName();
+    int getNumRegions();
+    BoundedRegion* getRegion(int index);
+    std::vector<BoundedRegion*>& getRegions();
+
+    void addRegion(BoundedRegion* region);
+    virtual BoundedRegion* findRegion(neutron* neutron);
+    virtual BoundedRegion* findRegion(float x, float y, float z);
+};
+
+
+/**
+ * @class Lattice Lattice.h "pinspec/src/Lattice.h"
+ * @brief A Lattice is a rectangular array of cells in the xy-plane, each of
+ *        which is filled by a Universe.
+ * @details The lattice is centered on the origin. The cells are indexed
+ *          from the cell in the lower left corner of the lattice along the
+ *          x-axis and then along the y-axis, such that the cell containing
+ *          a point is found in constant time. A neutron in a lattice is
+ *          tracked in the local coordinates of its cell and is moved to the
+ *          adjacent cell when it crosses an edge of its cell, rather than 
+ *          being located again from its global coordinates. The lattice is
+ *          bounded by REFLECTIVE surfaces by default.
+ */
+class Lattice {
+
+private:
+    /** The name of the lattice */
+    char* _lattice_name;
+    /** The number of cells along the x-axis */
+    int _num_x;
+    /** The number of cells along the y-axis */
+    int _num_y;
+    /** The width of each cell along the x-axis */
+    float _width_x;
+    /** The width of each cell along the y-axis */
+    float _width_y;
+    /** The minimum x-coordinate of the lattice */
+    float _x_min;
+    /** The minimum y-coordinate of the lattice */
+    float _y_min;
+    /** The universe filling each cell */
+    std::vector<Universe*> _universes;
+    /** The surfaces bounding the lattice (left, right, bottom and top) */
+    Surface* _boundary_surfaces[4];
+
+public:
+    Lattice(int num_x, int num_y, float width_x, float width_y,
+            const char* lattice_name=(char*)"");
+    virtual ~Lattice();
+
+    char* getName();
+    int getNumX();
+    int getNumY();
+    int getNumCells();
+    float getWidthX();
+    float getWidthY();
+    boundaryType getBoundaryType();
+    Surface* getBoundarySurface(int index);
+    Universe* getUniverse(int cell);
+    std::vector<Universe*> getUniqueUniverses();
+    std::vector<BoundedRegion*> getRegions();
+
+    void setBoundaryType(boundaryType type);
+    void setUniverse(int i, int j, Universe* universe);
+    void fillUniverse(Universe* universe);
+
+    int getCell(float x, float y) const;
+    int getCell(int i, int j) const;
+    float getCellCenterX(int cell) const;
+    float getCellCenterY(int cell) const;
+    void toLocalCoords(neutron* neutron);
+    void toGlobalCoords(neutron* neutron);
+    void applyBoundaryCondition(neutron* neutron);
+    bool updateCell(neutron* neutron);
+};
+
+
+/**
+ * @brief Returns the lattice cell containing a point in the xy-plane.
+ * @param x the x-coordinate of interest
+ * @param y the y-coordinate of interest
+ * @return the index of the lattice cell, or -1 if the point is outside of
+ *         the lattice
+ */
+inline int Lattice::getCell(float x, float y) const {
+
+    float i = floor((x - _x_min) / _width_x);
+    float j = floor((y - _y_min) / _width_y);
+
+    if (i < 0 || j < 0 || i >= _num_x || j >= _num_y)
+        return -1;
+
+    return int(j) * _num_x + int(i);
+}
+
+
+/**
+ * @brief Returns the index of the lattice cell at some column and row.
+ * @param i the index of the cell along the x-axis
+ * @param j the index of the cell along the y-axis
+ * @return the index of the lattice cell
+ */
+inline int Lattice::getCell(int i, int j) const {
+    return j * _num_x + i;
+}
+
+
+/**
+ * @brief Returns the x-coordinate of the center of a lattice cell.
+ * @param cell the index of the lattice cell
+ * @return the x-coordinate of the cell's center
+ */
+inline float Lattice::getCellCenterX(int cell) const {
+    return _x_min + (cell % _num_x + 0.5) * _width_x;
+}
+
+
+/**
+ * @brief Returns the y-coordinate of the center of a lattice cell.
+ * @param cell the index of the lattice cell
+ * @return the y-coordinate of the cell's center
+ */
+inline float Lattice::getCellCenterY(int cell) const {
+    return _y_min + (cell / _num_x + 0.5) * _width_y;
+}
+
+
+#endif /* LATTICE_H_ */
@@ -8,7 +8,7 @@ int Material::_n = 1;
  * @brief Material constructor.
  * @details Sets the user-defined name along with default values for the
  *          material density (0), material number density (0), material
- *          atomic mass (1), buckling (0) and volume (0).
+ *          atomic mass (1), buckling (0), volume (0) and temperature (300 K).
  */
 Material::Material(char* material_name) {
 
@@ -25,6 +25,13 @@ Material::Material(char* material_name) {
     _material_atomic_mass = 1.0;
     _buckling_squared = 0.0;
     _volume = 0.0;
+    _temperature = 300.0;
+
+    /* The cross-section tables are built before transport */
+    _xs_tables = NULL;
+    _num_table_isotopes = 0;
+    _num_table_energies = 0;
+    _xs_table_revision = -1;
 }
 
 
@@ -35,6 +42,7 @@ Material::Material(char* material_name) {
  */
 Material::~Material() { 
     delete [] _material_name;
+    clearXSTables();
 }
 
 
@@ -148,6 +156,15 @@ float Material::getVolume() {
 }
 
 
+/**
+ * @brief Returns the temperature of the material (K).
+ * @return the material's temperature
+ */
+float Material::getTemperature() {
+    return _temperature;
+}
+
+
 /**
  * @brief Returns the total number of energies for which cross-sections are
  *        defined for one of the material's cross-section types.
@@ -255,20 +272,335 @@ void Material::retrieveXS(float* xs, int num_xs, char* xs_type) {
 }
 
 
+/**
+ * @brief Tabulates the material's macroscopic cross-sections on the uniform
+ *        lethargy grid shared by its isotopes.
+ * @details For each cross-section type and grid energy the tables hold the
+ *          product of the number density and microscopic cross-section of 
+ *          each isotope, with the isotopes stored contiguously. A macroscopic
+ *          cross-section is then evaluated with a single grid index for all
+ *          isotopes and a vectorized interpolation and sum over the isotopes.
+ *          The tables are used until the cross-sections of one of the 
+ *          material's isotopes change, after which the material falls back 
+ *          to evaluating each isotope until the tables are rebuilt. The 
+ *          tables are not built if any isotope uses temperature tables or a
+ *          multipole representation since its cross-sections then depend on
+ *          temperature. This method is called for each material before a 
+ *          Monte Carlo simulation.
+ */
+void Material::buildXSTables() {
+
+    if (hasXSTables()) {
+        _xs_table_revision = Isotope::getLastXSRevision();
+        return;
+    }
+
+    clearXSTables();
+
+    if (_isotopes.empty())
+        return;
+
+    std::map<char*, std::pair<float, Isotope*> >::iterator iter;
+    Isotope* first = _isotopes.begin()->second.second;
+    int num_energies = first->getNumXSEnergies((char*)"total");
+    const char* xs_types[5] = {"elastic", "capture", "fission", "absorption",
+                               "total"};
+    std::vector<float> densities;
+
+    /* Check that each isotope's cross-sections are on the same grid and do
+     * not depend on temperature */
+    for (iter = _isotopes.begin(); iter != _isotopes.end(); ++iter) {
+
+        Isotope* isotope = iter->second.second;
+        bool tabulated = isotope->isRescaled() && !isotope->isUpdatingXS() &&
+                         !isotope->usesMultipole() && 
+                         isotope->getNumTemperatureTables() == 0 &&
+                         isotope->getStartLethargy() == 
+                                                 first->getStartLethargy() &&
+                         isotope->getDeltaLethargy() == 
+                                                 first->getDeltaLethargy();
+
+        for (int i=0; i < 5; i++) {
+            if (isotope->getNumXSEnergies((char*)xs_types[i]) != num_energies)
+                tabulated = false;
+        }
+
+        if (!tabulated) {
+            log_printf(INFO, "Unable to tabulate the cross-sections for "
+                       "material %s since isotope %s is not on a shared "
+                       "temperature-independent uniform lethargy grid", 
+                       _material_name, isotope->getIsotopeName());
+            return;
+        }
+
+        _table_isotopes.push_back(isotope);
+        _table_isotope_revisions.push_back(isotope->getXSRevision());
+        densities.push_back(iter->second.first);
+    }
+
+    _num_table_isotopes = _table_isotopes.size();
+    _num_table_energies = num_energies;
+    _table_start_lethargy = first->getStartLethargy();
+    _table_end_lethargy = first->getEndLethargy();
+    _table_delta_lethargy = first->getDeltaLethargy();
+
+    /* Each table is padded with a copy of its last grid energy such that 
+     * interpolation from the last index stays within the table */
+    _xs_tables = new float[size_t(NUM_XS_TYPES) * (num_energies + 1) * 
+                           _num_table_isotopes];
+
+    for (int j=0; j < _num_table_isotopes; j++) {
+
+        Isotope* isotope = _table_isotopes[j];
+        float density = densities[j];
+
+        #pragma omp parallel for
+        for (int i=0; i <= num_energies; i++) {
+
+            int index = std::min(i, num_energies - 1);
+            size_t offset = size_t(i) * _num_table_isotopes + j;
+            size_t stride = size_t(num_energies + 1) * _num_table_isotopes;
+
+            _xs_tables[ELASTIC_XS * stride + offset] = density * 
+                                             isotope->getElasticXS(index);
+            _xs_tables[CAPTURE_XS * stride + offset] = density * 
+                                             isotope->getCaptureXS(index);
+            _xs_tables[FISSION_XS * stride + offset] = density * 
+                                             isotope->getFissionXS(index);
+            _xs_tables[ABSORPTION_XS * stride + offset] = density * 
+                                             isotope->getAbsorptionXS(index);
+            _xs_tables[TOTAL_XS * stride + offset] = density * 
+                                             isotope->getTotalXS(index);
+            _xs_tables[TRANSPORT_XS * stride + offset] = density * 
+                                             isotope->getTransportXS(index);
+        }
+    }
+
+    _xs_table_revision = Isotope::getLastXSRevision();
+
+    log_printf(INFO, "Tabulated the cross-sections for material %s with %d "
+               "isotopes", _material_name, _num_table_isotopes);
+}
+
+
+/**
+ * @brief Deletes the material's cross-section tables.
+ */
+void Material::clearXSTables() {
+
+    if (_xs_tables != NULL)
+        delete [] _xs_tables;
+
+    _xs_tables = NULL;
+    _table_isotopes.clear();
+    _table_isotope_revisions.clear();
+    _num_table_isotopes = 0;
+    _xs_table_revision = -1;
+}
+
+
+/**
+ * @brief Checks the cross-section revision of each isotope in the material's
+ *        cross-section tables against that at which the tables were built.
+ * @return true if no isotope's cross-sections have changed; otherwise false
+ */
+bool Material::checkXSTableRevisions() const {
+
+    for (int i=0; i < _num_table_isotopes; i++) {
+        if (_table_isotopes[i]->getXSRevision() != 
+            _table_isotope_revisions[i])
+            return false;
+    }
+
+    return true;
+}
+
+
+/**
+ * @brief Returns whether the cross-section tables of this material and of
+ *        another material are on the same uniform lethargy grid.
+ * @param material a pointer to the other material
+ * @return true if both materials have tables on the same grid, otherwise
+ *         false
+ */
+bool Material::sharesXSTableGrid(Material* material) const {
+
+    if (!hasXSTables() || !material->hasXSTables())
+        return false;
+
+    return _num_table_energies == material->_num_table_energies &&
+           _table_start_lethargy == material->_table_start_lethargy &&
+           _table_delta_lethargy == material->_table_delta_lethargy;
+}
+
+
+/**
+ * @brief Evaluates a macroscopic cross-section for an array of energies.
+ * @details The energies are evaluated in parallel. If the material's 
+ *          cross-section tables are up to date each energy is evaluated 
+ *          from the tables; otherwise each isotope is evaluated at the 
+ *          temperature of interest.
+ * @param type the cross-section type
+ * @param energies an array of energies (eV)
+ * @param xs an array to fill with the macroscopic cross-sections 
+ *        \f$ (cm^{-1}) \f$
+ * @param num_energies the number of energies
+ * @param temperature the temperature of interest (K)
+ */
+void Material::evaluateMacroXS(xsType type, float* energies, float* xs, 
+                               int num_energies, float temperature) {
+
+    if (hasXSTables()) {
+
+        #pragma omp parallel for
+        for (int i=0; i < num_energies; i++)
+            xs[i] = evaluateXSTable(type, energies[i]);
+
+        return;
+    }
+
+    #pragma omp parallel for
+    for (int i=0; i < num_energies; i++) {
+
+        switch (type) {
+            case ELASTIC_XS:
+                xs[i] = getElasticMacroXS(energies[i], temperature);
+                break;
+            case CAPTURE_XS:
+                xs[i] = getCaptureMacroXS(energies[i], temperature);
+                break;
+            case FISSION_XS:
+                xs[i] = getFissionMacroXS(energies[i], temperature);
+                break;
+            case ABSORPTION_XS:
+                xs[i] = getAbsorptionMacroXS(energies[i], temperature);
+                break;
+            case TOTAL_XS:
+                xs[i] = getTotalMacroXS(energies[i], temperature);
+                break;
+            case TRANSPORT_XS:
+                xs[i] = getTransportMacroXS(energies[i], temperature);
+                break;
+            case UNKNOWN_XS:
+                xs[i] = std::numeric_limits<float>::quiet_NaN();
+                break;
+        }
+    }
+}
+
+
+/**
+ * @brief Evaluates one of the material's macroscopic cross-sections at each
+ *        energy in a numpy array.
+ * @details This is a helper function for users to evaluate cross-sections
+ *          at many energies from Python at the speed of C++. In Python one
+ *          only passes in the array of energies and the number of energies,
+ *          and a numpy array of the cross-sections is returned. The 
+ *          cross-sections are evaluated at the material's temperature, and
+ *          are NaN if the type of cross-section is unknown. An example of 
+ *          how this function might be called in Python is as follows:
+ *
+ * @code
+ *          energies = numpy.logspace(-2, 4, 1000000)
+ *          xs = material.evaluateMacroXS(energies, energies.size, 'total')
+ * @endcode
+ *
+ * @param energies an array of energies (eV)
+ * @param num_energies the number of energies
+ * @param xs an array to fill with the macroscopic cross-sections 
+ *        \f$ (cm^{-1}) \f$
+ * @param num_xs the number of cross-section values
+ * @param xs_type the type of cross-section (ie, 'capture')
+ */
+void Material::evaluateMacroXS(double* energies, int num_energies, float* xs,
+                               int num_xs, char* xs_type) {
+
+    if (num_xs != num_energies) {
+        log_printf(ERROR, "Unable to evaluate the macro %s xs for material "
+                   "%s since the number of xs values is %d while the number "
+                   "of energies is %d", xs_type, _material_name, num_xs, 
+                   num_energies);
+        return;
+    }
+
+    xsType type = Isotope::getXSType(xs_type);
+
+    if (type == UNKNOWN_XS) {
+        std::fill(xs, xs + num_xs, std::numeric_limits<float>::quiet_NaN());
+        return;
+    }
+
+    /* Energies are passed in from numpy in double precision */
+    std::vector<float> float_energies(energies, energies + num_energies);
+
+    evaluateMacroXS(type, float_energies.data(), xs, num_energies, 
+                    _temperature);
+}
+
+
+/**
+ * @brief Evaluates one of the material's microscopic cross-sections at each
+ *        energy in a numpy array.
+ * @details The microscopic cross-sections are the macroscopic 
+ *          cross-sections divided by the material's number density. An 
+ *          example of how this function might be called in Python is as 
+ *          follows:
+ *
+ * @code
+ *          energies = numpy.logspace(-2, 4, 1000000)
+ *          xs = material.evaluateMicroXS(energies, energies.size, 'total')
+ * @endcode
+ *
+ * @param energies an array of energies (eV)
+ * @param num_energies the number of energies
+ * @param xs an array to fill with the microscopic cross-sections 
+ * @param num_xs the number of cross-section values
+ * @param xs_type the type of cross-section (ie, 'capture')
+ */
+void Material::evaluateMicroXS(double* energies, int num_energies, float* xs,
+                               int num_xs, char* xs_type) {
+
+    evaluateMacroXS(energies, num_energies, xs, num_xs, xs_type);
+
+    if (num_xs != num_energies)
+        return;
+
+    for (int i=0; i < num_xs; i++)
+        xs[i] /= _material_number_density;
+}
+
+
 /**
  * @brief Returns the total macroscopic cross-section for the material
  *        at some energy (eV).
+ * @details The cross-section is evaluated at the material's temperature.
  * @param energy energy of interest (eV)
  * @return the total macroscopic cross-section \f$ (cm^{-1}) \f$
  */
 float Material::getTotalMacroXS(float energy) {
+    return getTotalMacroXS(energy, _temperature);
+}
+
+
+/**
+ * @brief Returns the total macroscopic cross-section for the material
+ *        at some energy (eV)
+ *        and temperature (K).
+ * @param energy energy of interest (eV)
+ * @param temperature the temperature of interest (K)
+ * @return the total macroscopic cross-section \f$ (cm^{-1}) \f$
+ */
+float Material::getTotalMacroXS(float energy, float temperature) {
+
+    if (hasXSTables())
+        return evaluateXSTable(TOTAL_XS, energy);
 
     float sigma_t = 0;
 
     /* Increment sigma_t for each isotope */
     std::map<char*, std::pair<float, Isotope*> >::iterator iter;
     for (iter = _isotopes.begin(); iter != _isotopes.end(); ++iter)
-         sigma_t += iter->second.second->getTotalXS(energy) 
+         sigma_t += iter->second.second->getTotalXS(energy, temperature) 
 	            * iter->second.first;
 
     return sigma_t;
@@ -331,6 +663,7 @@ float Material::getTotalMicroXS(int energy_index) {
 /**
  * @brief Returns the total macroscopic elastic scattering cross-section 
  *        for the material at some energy (eV).
+ * @details The cross-section is evaluated at the material's temperature.
  * @param energy the energy of interest (eV)
  * @return the total macroscopic elastic scattering cross-section 
  *         \f$ (cm^{-1}) \f$
@@ -338,13 +671,32 @@ float Material::getTotalMicroXS(int energy_index) {
  * @return the total elastic macroscopic scattering cross-section (cm^-1)
  */
 float Material::getElasticMacroXS(float energy) {
+    return getElasticMacroXS(energy, _temperature);
+}
+
+
+/**
+ * @brief Returns the total macroscopic elastic scattering cross-section 
+ *        for the material at some energy (eV)
+ *        and temperature (K).
+ * @param energy the energy of interest (eV)
+ * @param temperature the temperature of interest (K)
+ * @return the total macroscopic elastic scattering cross-section 
+ *         \f$ (cm^{-1}) \f$
+ * @param energy energy of interest (eV)
+ * @return the total elastic macroscopic scattering cross-section (cm^-1)
+ */
+float Material::getElasticMacroXS(float energy, float temperature) {
+
+    if (hasXSTables())
+        return evaluateXSTable(ELASTIC_XS, energy);
 
     float sigma_s = 0;
 
     /* Increment sigma_s for each isotope */
     std::map<char*, std::pair<float, Isotope*> >::iterator iter;
     for (iter = _isotopes.begin(); iter != _isotopes.end(); ++iter)
-	sigma_s += iter->second.second->getElasticXS(energy)
+	sigma_s += iter->second.second->getElasticXS(energy, temperature)
 		   * iter->second.first;
 
     return sigma_s;
@@ -384,7 +736,7 @@ float Material::getElasticMicroXS(float energy) {
     /* Increment sigma_s for each isotope */
     std::map<char*, std::pair<float, Isotope*> >::iterator iter;
     for (iter = _isotopes.begin(); iter != _isotopes.end(); ++iter)
-	sigma_s += iter->second.second->getElasticXS(energy);
+	sigma_s += iter->second.second->getElasticXS(energy, _temperature);
 
     return sigma_s;
 }
@@ -412,19 +764,37 @@ float Material::getElasticMicroXS(int energy_index) {
 /**
  * @brief Returns the total macroscopic absorption cross-section for the 
  *        material at some energy.
+ * @details The cross-section is evaluated at the material's temperature.
  * @param energy the energy of interest (eV)
  * @return the total macroscopic absorption cross-section \f$ (cm^{-1}) \f$
  * @param energy energy of interest (eV)
  * @return the total macroscopic absorption cross-section (cm^-1)
  */
 float Material::getAbsorptionMacroXS(float energy) {
+    return getAbsorptionMacroXS(energy, _temperature);
+}
+
+
+/**
+ * @brief Returns the total macroscopic absorption cross-section for the 
+ *        material at some energy and temperature.
+ * @param energy the energy of interest (eV)
+ * @param temperature the temperature of interest (K)
+ * @return the total macroscopic absorption cross-section \f$ (cm^{-1}) \f$
+ * @param energy energy of interest (eV)
+ * @return the total macroscopic absorption cross-section (cm^-1)
+ */
+float Material::getAbsorptionMacroXS(float energy, float temperature) {
+
+    if (hasXSTables())
+        return evaluateXSTable(ABSORPTION_XS, energy);
 
     float sigma_a = 0;
 
     /* Increment sigma_a for each isotope */
     std::map<char*, std::pair<float, Isotope*> >::iterator iter;
     for (iter = _isotopes.begin(); iter != _isotopes.end(); ++iter)
-	sigma_a += iter->second.second->getAbsorptionXS(energy) *
+	sigma_a += iter->second.second->getAbsorptionXS(energy, temperature) *
 		   iter->second.first;
 
     return sigma_a;
@@ -463,7 +833,7 @@ float Material::getAbsorptionMicroXS(float energy) {
      /* Increment sigma_a for each isotope */
      std::map<char*, std::pair<float, Isotope*> >::iterator iter;
      for (iter = _isotopes.begin(); iter != _isotopes.end(); ++iter)
-  	sigma_a += iter->second.second->getAbsorptionXS(energy);
+  	sigma_a += iter->second.second->getAbsorptionXS(energy, _temperature);
 
      return sigma_a;
 }
@@ -491,19 +861,38 @@ float Material::getAbsorptionMicroXS(int energy_index) {
 /**
  * @brief Returns the total macroscopic capture cross-section within this 
  *        material at some energy (eV).
+ * @details The cross-section is evaluated at the material's temperature.
  * @param energy the energy of interest (eV)
  * @return the total macroscopic capture cross-section \f$ (cm^{-1}) \f$
  * @param energy energy of interest (eV)
  * @return the total macroscopic capture cross-section (cm^-1)
  */
 float Material::getCaptureMacroXS(float energy) {
+    return getCaptureMacroXS(energy, _temperature);
+}
+
+
+/**
+ * @brief Returns the total macroscopic capture cross-section within this 
+ *        material at some energy (eV)
+ *        and temperature (K).
+ * @param energy the energy of interest (eV)
+ * @param temperature the temperature of interest (K)
+ * @return the total macroscopic capture cross-section \f$ (cm^{-1}) \f$
+ * @param energy energy of interest (eV)
+ * @return the total macroscopic capture cross-section (cm^-1)
+ */
+float Material::getCaptureMacroXS(float energy, float temperature) {
+
+    if (hasXSTables())
+        return evaluateXSTable(CAPTURE_XS, energy);
 
     float sigma_c = 0;
 
     /* Increment sigma_a for each isotope */
     std::map<char*, std::pair<float, Isotope*> >::iterator iter;
     for (iter = _isotopes.begin(); iter != _isotopes.end(); ++iter)
-	sigma_c += iter->second.second->getCaptureXS(energy) *
+	sigma_c += iter->second.second->getCaptureXS(energy, temperature) *
 										    iter->second.first;
 
     return sigma_c;
@@ -543,7 +932,7 @@ float Material::getCaptureMicroXS(float energy) {
     /* Increment sigma_a for each isotope */
     std::map<char*, std::pair<float, Isotope*> >::iterator iter;
     for (iter = _isotopes.begin(); iter != _isotopes.end(); ++iter)
- 	sigma_a += iter->second.second->getCaptureXS(energy);
+ 	sigma_a += iter->second.second->getCaptureXS(energy, _temperature);
 
     return sigma_a;
 }
@@ -571,19 +960,38 @@ float Material::getCaptureMicroXS(int energy_index) {
 /**
  * @brief Returns the total macroscopic fission cross-section for the material
  *        at some energy (eV).
+ * @details The cross-section is evaluated at the material's temperature.
  * @param energy the energy of interest (eV)
  * @return the total macroscopic fission cross-section \f$ (cm^{-1}) \f$
  * @param energy energy of interest (eV)
  * @return the total macroscopic fission cross-section (cm^-1)
  */
 float Material::getFissionMacroXS(float energy) {
+    return getFissionMacroXS(energy, _temperature);
+}
+
+
+/**
+ * @brief Returns the total macroscopic fission cross-section for the material
+ *        at some energy (eV)
+ *        and temperature (K).
+ * @param energy the energy of interest (eV)
+ * @param temperature the temperature of interest (K)
+ * @return the total macroscopic fission cross-section \f$ (cm^{-1}) \f$
+ * @param energy energy of interest (eV)
+ * @return the total macroscopic fission cross-section (cm^-1)
+ */
+float Material::getFissionMacroXS(float energy, float temperature) {
+
+    if (hasXSTables())
+        return evaluateXSTable(FISSION_XS, energy);
 
     float sigma_f = 0;
 
     /* Increment sigma_f for each isotope */
     std::map<char*, std::pair<float, Isotope*> >::iterator iter;
     for (iter = _isotopes.begin(); iter != _isotopes.end(); ++iter)
-   	sigma_f += iter->second.second->getFissionXS(energy) *
+   	sigma_f += iter->second.second->getFissionXS(energy, temperature) *
 		   iter->second.first;
 
     return sigma_f;
@@ -623,7 +1031,7 @@ float Material::getFissionMicroXS(float energy) {
     /* Increment sigma_f for each isotope */
     std::map<char*, std::pair<float, Isotope*> >::iterator iter;
     for (iter = _isotopes.begin(); iter != _isotopes.end(); ++iter)
-	sigma_f += iter->second.second->getFissionXS(energy);
+	sigma_f += iter->second.second->getFissionXS(energy, _temperature);
 
     return sigma_f;
 }
@@ -661,7 +1069,7 @@ float Material::getTransportMicroXS(float energy) {
     /* Increment sigma_a for each isotope */
     std::map<char*, std::pair<float, Isotope*> >::iterator iter;
     for (iter = _isotopes.begin(); iter != _isotopes.end(); ++iter)
-	sigma_tr += iter->second.second->getTransportXS(energy);
+	sigma_tr += iter->second.second->getTransportXS(energy, _temperature);
 
     return sigma_tr;
 }
@@ -690,17 +1098,34 @@ float Material::getTransportMacroXS(int energy_index) {
 /**
  * @brief Returns the total macroscopic transport cross-section for the material
  *        at some energy (eV)
+ * @details The cross-section is evaluated at the material's temperature.
  * @param energy the energy of interest (eV)
  * @return the total macroscopic transport cross-section \f$ (cm^{-1}) \f$
  */
 float Material::getTransportMacroXS(float energy) {
+    return getTransportMacroXS(energy, _temperature);
+}
+
+
+/**
+ * @brief Returns the total macroscopic transport cross-section for the material
+ *        at some energy (eV)
+ *        and temperature (K)
+ * @param energy the energy of interest (eV)
+ * @param temperature the temperature of interest (K)
+ * @return the total macroscopic transport cross-section \f$ (cm^{-1}) \f$
+ */
+float Material::getTransportMacroXS(float energy, float temperature) {
+
+    if (hasXSTables())
+        return evaluateXSTable(TRANSPORT_XS, energy);
     
     float sigma_tr = 0;
 
     /* Increment sigma_a for each isotope */
     std::map<char*, std::pair<float, Isotope*> >::iterator iter;
     for (iter = _isotopes.begin(); iter != _isotopes.end(); ++iter)
-	sigma_tr += iter->second.second->getTransportXS(energy) *
+	sigma_tr += iter->second.second->getTransportXS(energy, temperature) *
 		    iter->second.first;
 
     return sigma_tr;
@@ -829,6 +1254,26 @@ void Material::incrementVolume(float volume) {
 }
 
 
+/**
+ * @brief Sets the temperature of the material (K).
+ * @details The temperature is used to interpolate the cross-sections of 
+ *          any isotopes in the material which have temperature tables. 
+ *          Regions filled by the material may override its temperature.
+ * @param temperature the material's temperature (K)
+ */
+void Material::setTemperature(float temperature) {
+
+    if (temperature <= 0.0) {
+        log_printf(ERROR, "Unable to set the temperature of material %s to "
+                   "%f K since the temperature must be positive", 
+                   _material_name, temperature);
+        return;
+    }
+
+    _temperature = temperature;
+}
+
+
 /**
  * @brief Adds a new isotope to this material with a given atomic ratio.
  * @details The atomic ratio is the number of atoms of this isotope per
@@ -849,6 +1294,9 @@ void Material::addIsotope(Isotope* isotope, float atomic_ratio) {
     std::map<char*, std::pair<float, Isotope*> >::iterator iter;
     std::map<Isotope*, float> ::iterator iter_AO;
 
+    /* The number densities of all isotopes change */
+    clearXSTables();
+
     /* Remove prior version of this isotope if it is already in the material */
     iter = _isotopes.find(isotope->getIsotopeName());
     if (iter != _isotopes.end())
@@ -945,7 +1393,7 @@ void Material::addIsotope(Isotope* isotope, float atomic_ratio) {
  * @param neutron the neutron of interest
  */
 float Material::sampleDistanceTraveled(neutron* neutron) {
-    float sigma_t = getTotalMacroXS(neutron->_energy);
+    float sigma_t = getTotalMacroXS(neutron->_energy, neutron->_temperature);
     return -log(float(rand()) / RAND_MAX) / sigma_t;
 }
 
@@ -960,7 +1408,35 @@ float Material::sampleDistanceTraveled(neutron* neutron) {
 void Material::sampleIsotope(neutron* neutron) {
 
     float energy = neutron->_energy;
-    float sigma_t = getTotalMacroXS(energy);
+    float temperature = neutron->_temperature;
+
+    /* Sample the isotope from the total cross-section table */
+    if (hasXSTables()) {
+
+        float factor;
+        int index = getXSTableIndex(energy, &factor);
+        const float* lower = getXSTableRow(TOTAL_XS, index);
+        const float* upper = lower + _num_table_isotopes;
+        float sigma_t = evaluateXSTable(TOTAL_XS, energy);
+        float test = float(rand()) / RAND_MAX * sigma_t;
+        float cumulative_sigma_t = 0.0;
+
+        neutron->_path_length = 1.0 / sigma_t;
+        neutron->_isotope = _table_isotopes[_num_table_isotopes-1];
+
+        for (int i=0; i < _num_table_isotopes; i++) {
+            cumulative_sigma_t += lower[i] + factor * (upper[i] - lower[i]);
+
+            if (test <= cumulative_sigma_t) {
+                neutron->_isotope = _table_isotopes[i];
+                break;
+            }
+        }
+
+        return;
+    }
+
+    float sigma_t = getTotalMacroXS(energy, temperature);
     //    neutron->_total_xs = sigma_t;
     neutron->_path_length = 1.0 / sigma_t;
 
@@ -974,7 +1450,8 @@ void Material::sampleIsotope(neutron* neutron) {
 
     for (iter =_isotopes.begin(); iter !=_isotopes.end(); ++iter){
 
-        new_sigma_t_ratio += (iter->second.second->getTotalXS(energy) *
+        new_sigma_t_ratio += (iter->second.second->getTotalXS(energy, 
+                                                             temperature) *
 				  iter->second.first) / sigma_t;
 
         if (test >= sigma_t_ratio && ((test <= new_sigma_t_ratio) ||
@@ -1061,6 +1538,7 @@ Material* Material::clone() {
     }
 
     new_clone->setAtomicMass(_material_atomic_mass);
+    new_clone->setTemperature(_temperature);
 
     /* Return a pointer to the cloned Isotope class */
     return new_clone;
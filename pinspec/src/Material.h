@@ -55,6 +55,8 @@ private:
     float _buckling_squared;
     /** The total volume of all regions containing this material */
     float _volume;
+    /** The temperature of the material (K) */
+    float _temperature;
 
     /** Map relating isotope name to number density / isotope pairs */
     std::map<char*, std::pair<float, Isotope*> > _isotopes;
@@ -64,6 +66,36 @@ private:
     /** The units for the material's density (ie, 'g/cc' or 'at/cc') */
     densityUnit _density_unit;
 
+    /** The isotopes in the order of the columns of the cross-section 
+     *  tables */
+    std::vector<Isotope*> _table_isotopes;
+    /** The number of isotopes in the cross-section tables */
+    int _num_table_isotopes;
+    /** The number of energies in the uniform lethargy grid of the 
+     *  cross-section tables */
+    int _num_table_energies;
+    /** The starting lethargy of the uniform lethargy grid */
+    float _table_start_lethargy;
+    /** The final lethargy of the uniform lethargy grid */
+    float _table_end_lethargy;
+    /** The space between lethargies of the uniform lethargy grid */
+    float _table_delta_lethargy;
+    /** The number density times the microscopic cross-section of each 
+     *  isotope, for each cross-section type and energy in the uniform 
+     *  lethargy grid, with the isotopes for each energy stored contiguously */
+    float* _xs_tables;
+    /** The cross-section revision of each isotope in the tables at which 
+     *  the tables were built */
+    std::vector<int> _table_isotope_revisions;
+    /** The most recent cross-section revision of any isotope at which the 
+     *  tables were last found to be up to date */
+    int _xs_table_revision;
+
+    void clearXSTables();
+    bool checkXSTableRevisions() const;
+    const float* getXSTableRow(xsType type, int energy_index) const;
+    float evaluateXSTable(xsType type, float energy) const;
+
 public:
     Material(char* material_name);
     virtual ~Material();
@@ -79,30 +111,36 @@ public:
     bool containsIsotope(Isotope* isotope);
     float getBucklingSquared();
     float getVolume();
+    float getTemperature();
 
     int getNumXSEnergies(char* xs_type);
 
     float getTotalMacroXS(float energy);
+    float getTotalMacroXS(float energy, float temperature);
     float getTotalMacroXS(int energy_index);
     float getTotalMicroXS(float energy);
     float getTotalMicroXS(int energy_index);
 	
     float getElasticMacroXS(float energy);
+    float getElasticMacroXS(float energy, float temperature);
     float getElasticMacroXS(int energy_index);
     float getElasticMicroXS(float energy);
     float getElasticMicroXS(int energy_index);
 
     float getAbsorptionMacroXS(float energy);
+    float getAbsorptionMacroXS(float energy, float temperature);
     float getAbsorptionMacroXS(int energy_index);
     float getAbsorptionMicroXS(float energy);
     float getAbsorptionMicroXS(int energy_index);
 	
     float getCaptureMacroXS(float energy);
+    float getCaptureMacroXS(float energy, float temperature);
     float getCaptureMacroXS(int energy_index);
     float getCaptureMicroXS(float energy);
     float getCaptureMicroXS(int energy_index);
 	
     float getFissionMacroXS(float energy);
+    float getFissionMacroXS(float energy, float temperature);
     float getFissionMacroXS(int energy_index);
     float getFissionMicroXS(float energy);
     float getFissionMicroXS(int energy_index);
@@ -110,13 +148,25 @@ public:
     float getTransportMicroXS(float energy);
     float getTransportMicroXS(int energy_index);
     float getTransportMacroXS(float energy);
+    float getTransportMacroXS(float energy, float temperature);
     float getTransportMacroXS(int energy_index);
 
-    /* IMPORTANT: The following two class method prototypes must not be changed
-     * without changing Geometry.i to allow for the data arrays to be 
+    /* IMPORTANT: The following four class method prototypes must not be 
+     * changed without changing Geometry.i to allow for the data arrays to be 
      * transformed into numpy arrays */
     void retrieveXSEnergies(float* energies, int num_xs, char* xs_type);
     void retrieveXS(float* xs, int num_xs, char* xs_type);
+    void evaluateMacroXS(double* energies, int num_energies, float* xs, 
+                         int num_xs, char* xs_type);
+    void evaluateMicroXS(double* energies, int num_energies, float* xs, 
+                         int num_xs, char* xs_type);
+
+    void buildXSTables();
+    bool hasXSTables() const;
+    bool sharesXSTableGrid(Material* material) const;
+    int getXSTableIndex(float energy, float* factor) const;
+    void evaluateMacroXS(xsType type, float* energies, float* xs, 
+                         int num_energies, float temperature);
 		
     /* setters */
     void setMaterialName(char* name);
@@ -125,6 +175,7 @@ public:
     void setAtomicMass(float atomic_mass);
     void setBucklingSquared(float buckling_squared);
     void incrementVolume(float volume);
+    void setTemperature(float temperature);
     void addIsotope(Isotope *isotope, float atomic_ratio);
     
     Material *clone();
@@ -135,4 +186,101 @@ public:
 };
 
 
+
+/**
+ * @brief Returns the index into the uniform lethargy grid of the material's
+ *        cross-section tables for some energy.
+ * @details The index is computed in the same way as for each isotope by 
+ *          Isotope::getEnergyGridIndex, such that the tabulated 
+ *          cross-sections are interpolated between the same grid points.
+ * @param energy the energy (eV) of interest
+ * @param factor a pointer to the interpolation factor to set
+ * @return the index of the nearest grid energy less than or equal to energy
+ */
+inline int Material::getXSTableIndex(float energy, float* factor) const {
+
+    int index;
+    float lethargy = log10(energy);
+
+    if (lethargy > _table_end_lethargy)
+        index = _num_table_energies - 1;
+    else if (lethargy < _table_start_lethargy)
+        index = 0;
+    else
+        index = int(floor((lethargy - _table_start_lethargy) / 
+                          _table_delta_lethargy));
+
+    /* Interpolate in double precision like the isotopes since the lethargy
+     * has few significant digits left within each grid interval */
+    double lower_lethargy = _table_start_lethargy + 
+                            double(_table_delta_lethargy) * index;
+    *factor = (log10(double(energy)) - lower_lethargy) / _table_delta_lethargy;
+
+    return index;
+}
+
+
+/**
+ * @brief Returns a pointer to the tabulated cross-sections of each isotope
+ *        for a cross-section type at some energy in the uniform lethargy grid.
+ * @param type the cross-section type
+ * @param energy_index the index into the uniform lethargy grid
+ * @return a pointer to the cross-sections for each isotope
+ */
+inline const float* Material::getXSTableRow(xsType type, 
+                                            int energy_index) const {
+    return _xs_tables + (size_t(type) * (_num_table_energies + 1) + 
+                         energy_index) * _num_table_isotopes;
+}
+
+
+/**
+ * @brief Evaluates a macroscopic cross-section from the material's 
+ *        cross-section tables.
+ * @details The index into the uniform lethargy grid is computed once for all
+ *          isotopes, and since each isotope's cross-sections at neighboring
+ *          grid energies are stored contiguously, the interpolation and sum
+ *          over the isotopes is vectorized.
+ * @param type the cross-section type
+ * @param energy the energy (eV) of interest
+ * @return the macroscopic cross-section \f$ (cm^{-1}) \f$
+ */
+inline float Material::evaluateXSTable(xsType type, float energy) const {
+
+    float factor;
+    int index = getXSTableIndex(energy, &factor);
+    const float* lower = getXSTableRow(type, index);
+    const float* upper = lower + _num_table_isotopes;
+    float sigma = 0.0;
+
+    #pragma omp simd reduction(+:sigma)
+    for (int i=0; i < _num_table_isotopes; i++)
+        sigma += lower[i] + factor * (upper[i] - lower[i]);
+
+    return sigma;
+}
+
+
+/**
+ * @brief Returns whether the material's cross-section tables have been 
+ *        built and are up to date with the cross-sections of its isotopes.
+ * @details The revision of each isotope is only checked if the 
+ *          cross-sections of any isotope have changed since the tables were
+ *          last found to be up to date, which buildXSTables() records before
+ *          each simulation. This keeps the check in constant time for each 
+ *          cross-section lookup during a simulation.
+ * @return true if the tables are used for lookups; otherwise false
+ */
+inline bool Material::hasXSTables() const {
+
+    if (_xs_tables == NULL)
+        return false;
+
+    if (_xs_table_revision == Isotope::getLastXSRevision())
+        return true;
+
+    return checkXSTableRevisions();
+}
+
+
 #endif /* MATERIAL_H_ */
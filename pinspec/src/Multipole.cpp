@@ -0,0 +1,509 @@
+#include "Multipole.h"
+
+
+/**
+ * @brief Evaluates the Faddeeva function \f$ W(z) = e^{-z^2}erfc(-iz) \f$
+ *        for a complex argument in the upper half plane.
+ * @details This uses the four region rational approximation by J. Humlicek,
+ *          "Optimized Computation of the Voigt and Complex Probability
+ *          Functions", JQSRT 27, 1982, which has a relative accuracy of
+ *          roughly 1E-4 - more than sufficient for single precision
+ *          cross-sections.
+ * @param z the complex argument with a non-negative imaginary part
+ * @return the value of the Faddeeva function
+ */
+static std::complex<double> faddeeva(std::complex<double> z) {
+
+    double x = z.real();
+    double y = z.imag();
+    std::complex<double> t(y, -x);
+    double s = fabs(x) + y;
+
+    /* Region I */
+    if (s >= 15.0)
+        return t * 0.5641896 / (0.5 + t * t);
+
+    /* Region II */
+    if (s >= 5.5) {
+        std::complex<double> u = t * t;
+        return t * (1.410474 + u * 0.5641896) / (0.75 + u * (3.0 + u));
+    }
+
+    /* Region III */
+    if (y >= 0.195 * fabs(x) - 0.176)
+        return (16.4955 + t * (20.20933 + t * (11.96482 + t * (3.778987 +
+                t * 0.5642236)))) / (16.4955 + t * (38.82363 + t * (39.27121
+                + t * (21.69274 + t * (6.699398 + t)))));
+
+    /* Region IV */
+    std::complex<double> u = t * t;
+    return exp(u) - t * (36183.31 - u * (3321.9905 - u * (1540.787 - u *
+           (219.0313 - u * (35.76683 - u * (1.320522 - u * 0.56419)))))) /
+           (32066.6 - u * (24322.84 - u * (9022.228 - u * (2186.181 - u *
+           (364.2191 - u * (61.57037 - u * (1.841439 - u)))))));
+}
+
+
+/**
+ * @brief Computes the least squares polynomial fit to a set of data points.
+ * @details The coefficients are found by solving the normal equations with
+ *          Gaussian elimination and partial pivoting. The data should be
+ *          scaled to the interval [-1, 1] to keep the system well conditioned.
+ * @param x the array of abscissas
+ * @param y the array of values
+ * @param num_points the number of data points
+ * @param coeffs the array of NUM_BACKGROUND_TERMS coefficients to fill
+ */
+static void fitPolynomial(double* x, double* y, int num_points,
+                          double* coeffs) {
+
+    const int n = NUM_BACKGROUND_TERMS;
+    double matrix[n][n+1];
+
+    /* Build the normal equations */
+    memset(matrix, 0, sizeof(matrix));
+
+    for (int k=0; k < num_points; k++) {
+
+        double powers[n];
+        powers[0] = 1.0;
+        for (int i=1; i < n; i++)
+            powers[i] = powers[i-1] * x[k];
+
+        for (int i=0; i < n; i++) {
+            for (int j=0; j < n; j++)
+                matrix[i][j] += powers[i] * powers[j];
+            matrix[i][n] += powers[i] * y[k];
+        }
+    }
+
+    /* Forward elimination with partial pivoting */
+    for (int i=0; i < n; i++) {
+
+        int pivot = i;
+        for (int j=i+1; j < n; j++) {
+            if (fabs(matrix[j][i]) > fabs(matrix[pivot][i]))
+                pivot = j;
+        }
+
+        for (int j=0; j <= n; j++)
+            std::swap(matrix[i][j], matrix[pivot][j]);
+
+        for (int j=i+1; j < n; j++) {
+            double factor = matrix[j][i] / matrix[i][i];
+            for (int k=i; k <= n; k++)
+                matrix[j][k] -= factor * matrix[i][k];
+        }
+    }
+
+    /* Back substitution */
+    for (int i=n-1; i >= 0; i--) {
+        coeffs[i] = matrix[i][n];
+        for (int j=i+1; j < n; j++)
+            coeffs[i] -= matrix[i][j] * coeffs[j];
+        coeffs[i] /= matrix[i][i];
+    }
+
+    return;
+}
+
+
+/**
+ * @brief Multipole constructor.
+ * @details The multipole representation is empty until the poles are
+ *          generated from a set of resonance parameters.
+ * @param A the atomic mass number of the isotope
+ */
+Multipole::Multipole(int A) {
+
+    _A = A;
+    _num_poles = 0;
+    _num_windows = 0;
+    _energy_min = 0.0;
+    _energy_max = 0.0;
+}
+
+
+/**
+ * @brief Multipole destructor deletes the arrays of poles, residues and
+ *        window data.
+ */
+Multipole::~Multipole() {
+    clearPoles();
+}
+
+
+/**
+ * @brief Deletes the arrays of poles, residues and window data.
+ */
+void Multipole::clearPoles() {
+
+    if (_num_windows != 0) {
+        delete [] _poles;
+        delete [] _elastic_residues;
+        delete [] _capture_residues;
+        delete [] _window_offsets;
+        delete [] _window_poles;
+        delete [] _elastic_background;
+        delete [] _capture_background;
+    }
+
+    _num_poles = 0;
+    _num_windows = 0;
+}
+
+
+/**
+ * @brief Returns the number of poles evaluated explicitly within the windows.
+ * @return the number of poles
+ */
+int Multipole::getNumPoles() const {
+    return _num_poles;
+}
+
+
+/**
+ * @brief Returns the number of windows.
+ * @return the number of windows
+ */
+int Multipole::getNumWindows() const {
+    return _num_windows;
+}
+
+
+/**
+ * @brief Returns the minimum energy (eV) of the multipole representation.
+ * @return the minimum energy (eV)
+ */
+float Multipole::getEnergyMin() const {
+    return _energy_min;
+}
+
+
+/**
+ * @brief Returns the maximum energy (eV) of the multipole representation.
+ * @return the maximum energy (eV)
+ */
+float Multipole::getEnergyMax() const {
+    return _energy_max;
+}
+
+
+/**
+ * @brief Generates the poles, residues and window background fits from a
+ *        set of single-level Breit-Wigner resonance parameters.
+ * @details Each resonance at \f$ E_0 \f$ with total width \f$ \Gamma \f$ has
+ *          a pole at \f$ E_0 - i\Gamma/2 \f$ in energy, which maps to the
+ *          poles \f$ \pm\sqrt{E_0 - i\Gamma/2} \f$ in \f$ \sqrt{E} \f$. The
+ *          residues are chosen to reproduce the SLBW cross-sections used by
+ *          the slbw module. The poles near the positive real axis are
+ *          evaluated explicitly in the windows which they are near, while
+ *          the mirror poles, the potential scattering and the poles far from
+ *          each window are fit at 0K with a polynomial in each window.
+ * @param resonance_energies the resonance energies (eV)
+ * @param gamma_n the neutron widths (eV)
+ * @param gamma_g the capture widths (eV)
+ * @param num_resonances the number of resonances
+ * @param sigma_p the potential scattering cross-section (barns)
+ * @param num_windows the number of windows
+ * @param energy_min the minimum energy (eV) for the windows
+ * @param energy_max the maximum energy (eV) for the windows
+ */
+void Multipole::generatePoles(float* resonance_energies, float* gamma_n,
+                              float* gamma_g, int num_resonances,
+                              float sigma_p, int num_windows,
+                              float energy_min, float energy_max) {
+
+    if (num_resonances < 1) {
+        log_printf(ERROR, "Unable to generate a multipole representation "
+                   "without any resonances");
+        return;
+    }
+
+    if (num_windows < 1) {
+        log_printf(ERROR, "Unable to generate a multipole representation "
+                   "with %d windows", num_windows);
+        return;
+    }
+
+    if (energy_min <= 0.0 || energy_max <= energy_min) {
+        log_printf(ERROR, "Unable to generate a multipole representation "
+                   "between %f and %f eV", energy_min, energy_max);
+        return;
+    }
+
+    clearPoles();
+
+    int n = num_resonances;
+    std::vector< std::complex<double> > poles(n), mirror_poles(n);
+    std::vector< std::complex<double> > elastic(n), mirror_elastic(n);
+    std::vector< std::complex<double> > capture(n), mirror_capture(n);
+    double elastic_constant = 0.0;
+
+    /* Convert each resonance into a pair of poles and residues */
+    for (int i=0; i < n; i++) {
+
+        double E0 = resonance_energies[i];
+        double gamma = gamma_n[i] + gamma_g[i];
+        double r = (2603911.0 / E0) * double(_A + 1) / double(_A);
+        double q = sqrt(r * sigma_p);
+        std::complex<double> p = sqrt(std::complex<double>(E0, -gamma / 2.0));
+
+        /* The SLBW elastic and capture terms as residues of the pole in E */
+        std::complex<double> a = (gamma_n[i] / gamma) * (gamma_n[i] / gamma) *
+                                 (gamma / 2.0) * std::complex<double>(-2.0*q,
+                                                                      -r);
+        std::complex<double> b(0.0, -r * gamma_n[i] * gamma_g[i] /
+                                     (gamma * gamma) * sqrt(E0) * gamma / 2.0);
+
+        /* The pole at +p is stored as its conjugate in the upper half plane */
+        poles[i] = conj(p);
+        elastic[i] = conj(a * p / 2.0);
+        capture[i] = conj(b / 2.0);
+
+        mirror_poles[i] = -p;
+        mirror_elastic[i] = -a * p / 2.0;
+        mirror_capture[i] = b / 2.0;
+
+        elastic_constant -= a.real();
+    }
+
+    /* Sort the poles by their real parts */
+    std::vector< std::pair<double, int> > order(n);
+    for (int i=0; i < n; i++)
+        order[i] = std::make_pair(poles[i].real(), i);
+    std::sort(order.begin(), order.end());
+
+    _num_poles = n;
+    _poles = new std::complex<double>[n];
+    _elastic_residues = new std::complex<double>[n];
+    _capture_residues = new std::complex<double>[n];
+
+    for (int i=0; i < n; i++) {
+        _poles[i] = poles[order[i].second];
+        _elastic_residues[i] = elastic[order[i].second];
+        _capture_residues[i] = capture[order[i].second];
+    }
+
+    /* Find the poles which are evaluated explicitly in each window - those
+     * within one window width or four half-widths of the window */
+    _energy_min = energy_min;
+    _energy_max = energy_max;
+    _num_windows = num_windows;
+    _sqrt_energy_min = sqrt(energy_min);
+    _window_width = (sqrt(energy_max) - _sqrt_energy_min) / num_windows;
+    _window_offsets = new int[num_windows+1];
+
+    std::vector<int> window_poles;
+
+    for (int w=0; w < num_windows; w++) {
+
+        double lower = _sqrt_energy_min + w * _window_width;
+        double upper = lower + _window_width;
+
+        _window_offsets[w] = window_poles.size();
+
+        for (int i=0; i < n; i++) {
+            double distance = std::max(lower - _poles[i].real(),
+                                       _poles[i].real() - upper);
+            if (distance <= std::max(_window_width, 4.0 * _poles[i].imag()))
+                window_poles.push_back(i);
+        }
+    }
+
+    _window_offsets[num_windows] = window_poles.size();
+    _window_poles = new int[window_poles.size()];
+    std::copy(window_poles.begin(), window_poles.end(), _window_poles);
+
+    _elastic_background = new double[num_windows * NUM_BACKGROUND_TERMS];
+    _capture_background = new double[num_windows * NUM_BACKGROUND_TERMS];
+
+    /* Fit the contribution from the potential scattering, the mirror poles
+     * and the poles outside of each window at 0K */
+    #pragma omp parallel for
+    for (int w=0; w < num_windows; w++) {
+
+        double center = _sqrt_energy_min + (w + 0.5) * _window_width;
+        double x[NUM_BACKGROUND_SAMPLES];
+        double elastic_y[NUM_BACKGROUND_SAMPLES];
+        double capture_y[NUM_BACKGROUND_SAMPLES];
+
+        for (int k=0; k < NUM_BACKGROUND_SAMPLES; k++) {
+
+            x[k] = -1.0 + 2.0 * k / (NUM_BACKGROUND_SAMPLES - 1);
+            double u = center + x[k] * _window_width / 2.0;
+
+            elastic_y[k] = sigma_p * u * u + elastic_constant;
+            capture_y[k] = 0.0;
+
+            for (int i=0; i < n; i++) {
+                std::complex<double> mirror = 1.0 / (mirror_poles[i] - u);
+                std::complex<double> term = 1.0 / (_poles[i] - u);
+                elastic_y[k] += (mirror_elastic[i] * mirror).real() +
+                                (_elastic_residues[i] * term).real();
+                capture_y[k] += (mirror_capture[i] * mirror).real() +
+                                (_capture_residues[i] * term).real();
+            }
+
+            for (int j=_window_offsets[w]; j < _window_offsets[w+1]; j++) {
+                int i = _window_poles[j];
+                std::complex<double> term = 1.0 / (_poles[i] - u);
+                elastic_y[k] -= (_elastic_residues[i] * term).real();
+                capture_y[k] -= (_capture_residues[i] * term).real();
+            }
+        }
+
+        fitPolynomial(x, elastic_y, NUM_BACKGROUND_SAMPLES,
+                      &_elastic_background[w*NUM_BACKGROUND_TERMS]);
+        fitPolynomial(x, capture_y, NUM_BACKGROUND_SAMPLES,
+                      &_capture_background[w*NUM_BACKGROUND_TERMS]);
+    }
+
+    log_printf(INFO, "Generated %d windows with %d poles between %f and %f "
+               "eV", num_windows, n, energy_min, energy_max);
+
+    return;
+}
+
+
+/**
+ * @brief Evaluates the elastic scattering and capture cross-sections at some
+ *        energy and temperature.
+ * @details Only the poles within the window containing the energy are
+ *          evaluated, with one Faddeeva function evaluation per pole.
+ * @param energy the energy (eV) of interest
+ * @param temperature the temperature (K) of interest
+ * @param elastic_xs a pointer to the elastic scattering cross-section
+ * @param capture_xs a pointer to the capture cross-section
+ */
+void Multipole::evaluate(float energy, float temperature, float* elastic_xs,
+                         float* capture_xs) const {
+
+    double u = sqrt(double(energy));
+    int w = int((u - _sqrt_energy_min) / _window_width);
+
+    if (w < 0)
+        w = 0;
+    else if (w > _num_windows - 1)
+        w = _num_windows - 1;
+
+    /* Evaluate the polynomial background for the window */
+    double x = 2.0 * (u - _sqrt_energy_min) / _window_width - (2 * w + 1);
+    double* elastic_background = &_elastic_background[w*NUM_BACKGROUND_TERMS];
+    double* capture_background = &_capture_background[w*NUM_BACKGROUND_TERMS];
+    double elastic = 0.0;
+    double capture = 0.0;
+    double power = 1.0;
+
+    for (int k=0; k < NUM_BACKGROUND_TERMS; k++) {
+        elastic += elastic_background[k] * power;
+        capture += capture_background[k] * power;
+        power *= x;
+    }
+
+    /* Evaluate the Doppler broadened poles in the window */
+    if (temperature > 0.0) {
+
+        double delta = sqrt(8.617332E-5 * temperature / _A);
+        std::complex<double> factor(0.0, -sqrt(M_PI) / delta);
+
+        for (int j=_window_offsets[w]; j < _window_offsets[w+1]; j++) {
+            int i = _window_poles[j];
+            std::complex<double> term = factor *
+                                        faddeeva((_poles[i] - u) / delta);
+            elastic += (_elastic_residues[i] * term).real();
+            capture += (_capture_residues[i] * term).real();
+        }
+    }
+
+    /* Evaluate the poles at 0K */
+    else {
+        for (int j=_window_offsets[w]; j < _window_offsets[w+1]; j++) {
+            int i = _window_poles[j];
+            std::complex<double> term = 1.0 / (_poles[i] - u);
+            elastic += (_elastic_residues[i] * term).real();
+            capture += (_capture_residues[i] * term).real();
+        }
+    }
+
+    *elastic_xs = std::max(elastic / (u * u), 0.0);
+    *capture_xs = std::max(capture / (u * u), 0.0);
+
+    return;
+}
+
+
+/**
+ * @brief Returns the elastic scattering cross-section at some energy and
+ *        temperature.
+ * @param energy the energy (eV) of interest
+ * @param temperature the temperature (K) of interest
+ * @return the microscopic elastic scattering cross-section (barns)
+ */
+float Multipole::getElasticXS(float energy, float temperature) const {
+
+    float elastic_xs, capture_xs;
+    evaluate(energy, temperature, &elastic_xs, &capture_xs);
+    return elastic_xs;
+}
+
+
+/**
+ * @brief Returns the capture cross-section at some energy and temperature.
+ * @param energy the energy (eV) of interest
+ * @param temperature the temperature (K) of interest
+ * @return the microscopic capture cross-section (barns)
+ */
+float Multipole::getCaptureXS(float energy, float temperature) const {
+
+    float elastic_xs, capture_xs;
+    evaluate(energy, temperature, &elastic_xs, &capture_xs);
+    return capture_xs;
+}
+
+
+/**
+ * @brief Executes a deep copy of the multipole representation.
+ * @return a pointer to the new cloned Multipole class object
+ */
+Multipole* Multipole::clone() {
+
+    Multipole* new_clone = new Multipole(_A);
+
+    if (_num_windows == 0)
+        return new_clone;
+
+    int num_window_poles = _window_offsets[_num_windows];
+    int num_coeffs = _num_windows * NUM_BACKGROUND_TERMS;
+
+    new_clone->_num_poles = _num_poles;
+    new_clone->_num_windows = _num_windows;
+    new_clone->_energy_min = _energy_min;
+    new_clone->_energy_max = _energy_max;
+    new_clone->_sqrt_energy_min = _sqrt_energy_min;
+    new_clone->_window_width = _window_width;
+
+    new_clone->_poles = new std::complex<double>[_num_poles];
+    new_clone->_elastic_residues = new std::complex<double>[_num_poles];
+    new_clone->_capture_residues = new std::complex<double>[_num_poles];
+    new_clone->_window_offsets = new int[_num_windows+1];
+    new_clone->_window_poles = new int[num_window_poles];
+    new_clone->_elastic_background = new double[num_coeffs];
+    new_clone->_capture_background = new double[num_coeffs];
+
+    std::copy(_poles, _poles + _num_poles, new_clone->_poles);
+    std::copy(_elastic_residues, _elastic_residues + _num_poles,
+              new_clone->_elastic_residues);
+    std::copy(_capture_residues, _capture_residues + _num_poles,
+              new_clone->_capture_residues);
+    std::copy(_window_offsets, _window_offsets + _num_windows + 1,
+              new_clone->_window_offsets);
+    std::copy(_window_poles, _window_poles + num_window_poles,
+              new_clone->_window_poles);
+    std::copy(_elastic_background, _elastic_background + num_coeffs,
+              new_clone->_elastic_background);
+    std::copy(_capture_background, _capture_background + num_coeffs,
+              new_clone->_capture_background);
+
+    return new_clone;
+}
@@ -0,0 +1,121 @@
+/**
+ * @file Multipole.h
+ * @brief The Multipole class.
+ * @date October 18, 2026
+ */
+
+#ifndef MULTIPOLE_H_
+#define MULTIPOLE_H_
+
+#ifdef __cplusplus
+#include <math.h>
+#include <string.h>
+#include <complex>
+#include <vector>
+#include <algorithm>
+#include "log.h"
+#endif
+
+
+/** The number of polynomial terms in the background fit for each window */
+#define NUM_BACKGROUND_TERMS 4
+
+/** The number of energies sampled in each window for the background fits */
+#define NUM_BACKGROUND_SAMPLES 16
+
+
+/**
+ * @class Multipole Multipole.h "pinspec/src/Multipole.h"
+ * @brief A windowed multipole representation of the resolved resonances
+ *        for an isotope.
+ * @details Each single-level Breit-Wigner resonance is converted into a pair
+ *          of poles \f$ p_j \f$ with residues \f$ r_j \f$ in the momentum
+ *          space \f$ u = \sqrt{E} \f$ such that the 0K cross-section is
+ *          given by:
+ *
+ *          \f$ \sigma(u) = \frac{1}{u^2}\sum_j\Re\left[\frac{r_j}{p_j-u}
+ *              \right] \f$
+ *
+ *          The Doppler broadened cross-section at any temperature is found
+ *          by replacing each pole term with the Faddeeva function:
+ *
+ *          \f$ \frac{1}{p_j-u} \rightarrow \frac{-i\sqrt{\pi}}{\Delta}
+ *              W\left(\frac{p_j-u}{\Delta}\right) \f$ where
+ *              \f$ \Delta = \sqrt{\frac{kT}{A}} \f$
+ *
+ *          The range in \f$ u \f$ is divided into equal width windows. Only
+ *          the poles near a window are evaluated explicitly and the smooth
+ *          contribution from all other poles, as well as the potential
+ *          scattering, is represented by a polynomial fit in each window.
+ */
+class Multipole {
+
+private:
+    /** The atomic mass number of the isotope */
+    int _A;
+    /** The number of poles evaluated explicitly within the windows */
+    int _num_poles;
+    /** The poles in \f$ \sqrt{E} \f$ with positive imaginary parts */
+    std::complex<double>* _poles;
+    /** The residues for the elastic scattering cross-section */
+    std::complex<double>* _elastic_residues;
+    /** The residues for the capture cross-section */
+    std::complex<double>* _capture_residues;
+
+    /** The minimum energy (eV) for the multipole representation */
+    float _energy_min;
+    /** The maximum energy (eV) for the multipole representation */
+    float _energy_max;
+    /** The minimum \f$ \sqrt{E} \f$ for the windows */
+    double _sqrt_energy_min;
+    /** The width of each window in \f$ \sqrt{E} \f$ */
+    double _window_width;
+    /** The number of windows */
+    int _num_windows;
+    /** The offset into the window poles array for each window */
+    int* _window_offsets;
+    /** The indices of the poles evaluated explicitly in each window */
+    int* _window_poles;
+    /** The polynomial coefficients of the elastic scattering background for
+     *  each window */
+    double* _elastic_background;
+    /** The polynomial coefficients of the capture background for each
+     *  window */
+    double* _capture_background;
+
+    void clearPoles();
+
+public:
+    Multipole(int A);
+    virtual ~Multipole();
+
+    int getNumPoles() const;
+    int getNumWindows() const;
+    float getEnergyMin() const;
+    float getEnergyMax() const;
+    bool contains(float energy) const;
+
+    void generatePoles(float* resonance_energies, float* gamma_n,
+                       float* gamma_g, int num_resonances, float sigma_p,
+                       int num_windows, float energy_min, float energy_max);
+    void evaluate(float energy, float temperature, float* elastic_xs,
+                  float* capture_xs) const;
+    float getElasticXS(float energy, float temperature) const;
+    float getCaptureXS(float energy, float temperature) const;
+
+    Multipole* clone();
+};
+
+
+/**
+ * @brief Returns whether an energy is within the range of the multipole
+ *        representation.
+ * @param energy the energy (eV) of interest
+ * @return true if the energy is within the range; otherwise false
+ */
+inline bool Multipole::contains(float energy) const {
+    return (energy >= _energy_min && energy <= _energy_max);
+}
+
+
+#endif /* MULTIPOLE_H_ */
@@ -10,6 +10,10 @@ neutron* createNewNeutron() {
     neut->_batch_num = 0;
     neut->_energy = 0.0;
     neut->_old_energy = 0.0;
+    neut->_temperature = 300.0;
+    neut->_cell = -1;
+    neut->_region_index = -1;
+    neut->_halfspace_index = -1;
 
     return neut;
 }
@@ -63,6 +63,10 @@ public:
       * collided */
     Isotope* _isotope;
 
+    /** The temperature (K) of the Region in which the neutron is traveling,
+     * used to look up temperature-dependent cross-sections */
+    float _temperature;
+
 
     /***************************************************************************
      *****************  ATTRIBUTES FOR HETEROGENEOUS GEOMETRIES  ***************
@@ -70,6 +74,15 @@ public:
     /** A pointer to the nearest surface in a heterogeneous case */
     Surface* _surface;
 
+    /** The index of the neutron's region in the compiled geometry, or -1 if
+     * the geometry has not been compiled */
+    int _region_index;
+
+    /** The index of the halfspace of the neutron's region in the compiled 
+     * geometry which the neutron last moved towards, or -1 if the neutron
+     * is known to be within its region */
+    int _halfspace_index;
+
     /** The x-coordinate of this neutron's location */
     float _x;
 
@@ -88,6 +101,11 @@ public:
     /** The component of this neutron's velocity unit vector along the z-axis */
     float _w;
 
+    /** The index of the lattice cell containing the neutron, or -1 if the
+     * geometry is not filled by a lattice. The neutron's location is in the
+     * local coordinates of this cell */
+    int _cell;
+
     /** The cosine of the polar angle \f$\theta\f$ of this neutron's direction 
      * vector: \f$\mu = cos(\theta)\f$
      */
@@ -0,0 +1,305 @@
+#include "PinCell.h"
+
+
+/**
+ * @brief PinCell constructor.
+ * @details Generates the surfaces and regions of the pin cell. The gap or
+ *          cladding is left out if its outer radius is equal to that of the
+ *          region within it. Each fuel ring has the same volume, such that
+ *          the outer radius of ring \f$ i \f$ of \f$ n \f$ is
+ *          \f$ R \sqrt{(i+1)/n} \f$ for a fuel radius \f$ R \f$.
+ * @param fuel_radius the outer radius of the fuel (cm)
+ * @param gap_radius the outer radius of the gap (cm)
+ * @param cladding_radius the outer radius of the cladding (cm)
+ * @param pitch the width of the square cell (cm)
+ * @param num_fuel_rings the number of equal volume rings in the fuel
+ * @param universe_name the name of the pin cell
+ */
+PinCell::PinCell(float fuel_radius, float gap_radius, float cladding_radius,
+                 float pitch, int num_fuel_rings, const char* universe_name):
+    Universe(universe_name) {
+
+    _pitch = pitch;
+    _num_fuel_rings = 0;
+    _gap = NULL;
+    _cladding = NULL;
+    _moderator = NULL;
+
+    if (num_fuel_rings < 1 || fuel_radius <= 0.0 ||
+        gap_radius < fuel_radius || cladding_radius < gap_radius ||
+        2.0 * cladding_radius >= pitch) {
+        log_printf(ERROR, "Unable to create pin cell %s with %d fuel rings "
+                   "and radii %f, %f and %f cm in a %f cm cell since the "
+                   "radii must be increasing and within the cell",
+                   _universe_name, num_fuel_rings, fuel_radius, gap_radius,
+                   cladding_radius, pitch);
+        return;
+    }
+
+    char name[512];
+
+    for (int i=0; i < num_fuel_rings; i++) {
+        snprintf(name, 512, "%s fuel ring %d", _universe_name, i);
+        addRing(new BoundedFuelRegion(name),
+                fuel_radius * sqrt(float(i+1) / num_fuel_rings));
+    }
+
+    _num_fuel_rings = num_fuel_rings;
+
+    if (gap_radius > fuel_radius) {
+        snprintf(name, 512, "%s gap", _universe_name);
+        _gap = addRing(new BoundedGeneralRegion(name), gap_radius);
+    }
+
+    if (cladding_radius > gap_radius) {
+        snprintf(name, 512, "%s cladding", _universe_name);
+        _cladding = addRing(new BoundedGeneralRegion(name), cladding_radius);
+    }
+
+    /* The moderator is bounded by the outermost cylinder and the edges of
+     * the cell */
+    XPlane* left = new XPlane();
+    XPlane* right = new XPlane();
+    YPlane* bottom = new YPlane();
+    YPlane* top = new YPlane();
+
+    left->setX(-pitch / 2.0);
+    right->setX(pitch / 2.0);
+    bottom->setY(-pitch / 2.0);
+    top->setY(pitch / 2.0);
+
+    snprintf(name, 512, "%s moderator", _universe_name);
+    _moderator = new BoundedModeratorRegion(name);
+    _moderator->addBoundingSurface(1, _surfaces.back());
+    _moderator->addBoundingSurface(1, left);
+    _moderator->addBoundingSurface(-1, right);
+    _moderator->addBoundingSurface(1, bottom);
+    _moderator->addBoundingSurface(-1, top);
+    _moderator->setVolume(pitch * pitch - M_PI * _radii_squared.back());
+
+    _surfaces.push_back(left);
+    _surfaces.push_back(right);
+    _surfaces.push_back(bottom);
+    _surfaces.push_back(top);
+
+    for (int i=0; i < int(_surfaces.size()); i++)
+        _surfaces[i]->setBoundaryType(INTERFACE);
+
+    _rings.push_back(_moderator);
+    _regions.push_back(_moderator);
+}
+
+
+/**
+ * @brief PinCell destructor deletes the regions and surfaces generated for
+ *        the pin cell.
+ */
+PinCell::~PinCell() {
+
+    for (int i=0; i < int(_rings.size()); i++)
+        delete _rings[i];
+
+    for (int i=0; i < int(_surfaces.size()); i++)
+        delete _surfaces[i];
+}
+
+
+/**
+ * @brief Adds a ring outside of the outermost ring in the pin cell.
+ * @param ring the region to bound by the ring
+ * @param radius the outer radius of the ring (cm)
+ * @return a pointer to the region
+ */
+BoundedRegion* PinCell::addRing(BoundedRegion* ring, float radius) {
+
+    ZCylinder* cylinder = new ZCylinder();
+    cylinder->setRadius(radius);
+
+    ring->addBoundingSurface(-1, cylinder);
+    float inner_radius_squared = 0.0;
+
+    if (!_surfaces.empty()) {
+        ring->addBoundingSurface(1, _surfaces.back());
+        inner_radius_squared = _radii_squared.back();
+    }
+
+    ring->setVolume(M_PI * (radius * radius - inner_radius_squared));
+
+    _surfaces.push_back(cylinder);
+    _radii_squared.push_back(radius * radius);
+    _rings.push_back(ring);
+    _regions.push_back(ring);
+
+    return ring;
+}
+
+
+/**
+ * @brief Returns the width of the square cell.
+ * @return the pitch (cm)
+ */
+float PinCell::getPitch() {
+    return _pitch;
+}
+
+
+/**
+ * @brief Returns the number of equal volume rings in the fuel.
+ * @return the number of fuel rings
+ */
+int PinCell::getNumFuelRings() {
+    return _num_fuel_rings;
+}
+
+
+/**
+ * @brief Returns one of the rings in the fuel.
+ * @param ring the index of the ring, beginning with the innermost ring
+ * @return a pointer to the fuel ring region
+ */
+BoundedRegion* PinCell::getFuelRing(int ring) {
+
+    if (ring < 0 || ring >= _num_fuel_rings) {
+        log_printf(ERROR, "Unable to get fuel ring %d of pin cell %s which "
+                   "has %d fuel rings", ring, _universe_name,
+                   _num_fuel_rings);
+        return NULL;
+    }
+
+    return _rings[ring];
+}
+
+
+/**
+ * @brief Returns the gap region.
+ * @return a pointer to the gap region, or NULL if the pin cell has no gap
+ */
+BoundedRegion* PinCell::getGap() {
+    return _gap;
+}
+
+
+/**
+ * @brief Returns the cladding region.
+ * @return a pointer to the cladding region, or NULL if the pin cell has no
+ *         cladding
+ */
+BoundedRegion* PinCell::getCladding() {
+    return _cladding;
+}
+
+
+/**
+ * @brief Returns the moderator region.
+ * @return a pointer to the moderator region
+ */
+BoundedRegion* PinCell::getModerator() {
+    return _moderator;
+}
+
+
+/**
+ * @brief Fills each of the fuel rings with a material.
+ * @param material the fuel material
+ */
+void PinCell::setFuelMaterial(Material* material) {
+
+    for (int i=0; i < _num_fuel_rings; i++) {
+        _rings[i]->setMaterial(material);
+        _rings[i]->setVolume(_rings[i]->getVolume());
+    }
+}
+
+
+/**
+ * @brief Fills the gap with a material.
+ * @param material the gap material
+ */
+void PinCell::setGapMaterial(Material* material) {
+
+    if (_gap == NULL) {
+        log_printf(ERROR, "Unable to set the gap material for pin cell %s "
+                   "since it does not have a gap", _universe_name);
+        return;
+    }
+
+    _gap->setMaterial(material);
+    _gap->setVolume(_gap->getVolume());
+}
+
+
+/**
+ * @brief Fills the cladding with a material.
+ * @param material the cladding material
+ */
+void PinCell::setCladdingMaterial(Material* material) {
+
+    if (_cladding == NULL) {
+        log_printf(ERROR, "Unable to set the cladding material for pin cell "
+                   "%s since it does not have cladding", _universe_name);
+        return;
+    }
+
+    _cladding->setMaterial(material);
+    _cladding->setVolume(_cladding->getVolume());
+}
+
+
+/**
+ * @brief Fills the moderator with a material.
+ * @param material the moderator material
+ */
+void PinCell::setModeratorMaterial(Material* material) {
+    _moderator->setMaterial(material);
+    _moderator->setVolume(_moderator->getVolume());
+}
+
+
+/**
+ * @brief Finds the region in the pin cell containing a neutron.
+ * @details The ring containing the neutron is found by a binary search of
+ *          the squared radii of the rings, and a neutron outside of the
+ *          cladding is tested against the edges of the cell.
+ * @param neutron the neutron of interest in the local coordinates
+ * @return a pointer to the region, or NULL if no region was found
+ */
+BoundedRegion* PinCell::findRegion(neutron* neutron) {
+
+    float r_squared = neutron->_x * neutron->_x + neutron->_y * neutron->_y;
+    int ring = std::upper_bound(_radii_squared.begin(), _radii_squared.end(),
+                                r_squared) - _radii_squared.begin();
+
+    if (ring < int(_radii_squared.size()))
+        return _rings[ring];
+
+    if (_moderator != NULL && _moderator->contains(neutron))
+        return _moderator;
+
+    return NULL;
+}
+
+
+/**
+ * @brief Finds the region in the pin cell containing a point.
+ * @details The ring containing the point is found by a binary search of
+ *          the squared radii of the rings, and a point outside of the
+ *          cladding is tested against the edges of the cell.
+ * @param x the x-coordinate of interest in the local coordinates
+ * @param y the y-coordinate of interest in the local coordinates
+ * @param z the z-coordinate of interest
+ * @return a pointer to the region, or NULL if no region was found
+ */
+BoundedRegion* PinCell::findRegion(float x, float y, float z) {
+
+    float r_squared = x * x + y * y;
+    int ring = std::upper_bound(_radii_squared.begin(), _radii_squared.end(),
+                                r_squared) - _radii_squared.begin();
+
+    if (ring < int(_radii_squared.size()))
+        return _rings[ring];
+
+    if (_moderator != NULL && _moderator->contains(x, y, z))
+        return _moderator;
+
+    return NULL;
+}
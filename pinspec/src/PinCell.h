@@ -0,0 +1,89 @@
+/**
+ * @file PinCell.h
+ * @brief The PinCell class.
+ * @date October 18, 2026
+ */
+
+#ifndef PINCELL_H_
+#define PINCELL_H_
+
+#ifdef __cplusplus
+#include <vector>
+#include <algorithm>
+#include <math.h>
+#include <stdio.h>
+#include "Lattice.h"
+#endif
+
+
+/**
+ * @class PinCell PinCell.h "pinspec/src/PinCell.h"
+ * @brief A PinCell is a Universe of a fuel pin with a gap and cladding in a
+ *        square cell of moderator.
+ * @details The fuel is subdivided into equal volume rings, each of which is
+ *          a BoundedFuelRegion. The gap and cladding are BoundedGeneralRegions
+ *          and the moderator is a BoundedModeratorRegion bounded by the edges
+ *          of the cell. The region containing a point is found by a binary
+ *          search of the squared radii of the rings rather than by testing
+ *          the surfaces bounding each region. The volume of each region is
+ *          set to its area in the xy-plane. A pin cell fills the cells of a
+ *          Lattice, and a single pin cell is a 1 x 1 lattice. A user may
+ *          tally the flux in each fuel ring from within Python as follows:
+ *
+ * @code
+ *          pin = PinCell(0.4096, 0.418, 0.475, 1.26, 10, 'pin')
+ *          pin.setFuelMaterial(fuel)
+ *          pin.setModeratorMaterial(moderator)
+ *          for i in range(pin.getNumFuelRings()):
+ *              tally = TallyFactory.createTally(pin.getFuelRing(i), FLUX)
+ *              tally.generateBinEdges(1E-2, 1E7, 1000, LOGARITHMIC)
+ *              TallyBank.registerTally(tally)
+ * @endcode
+ */
+class PinCell: public Universe {
+
+private:
+    /** The width of the square cell (cm) */
+    float _pitch;
+    /** The number of equal volume rings in the fuel */
+    int _num_fuel_rings;
+    /** The squared outer radius of each region within the cladding */
+    std::vector<float> _radii_squared;
+    /** The regions within the cladding in order of increasing radius,
+     *  followed by the moderator */
+    std::vector<BoundedRegion*> _rings;
+    /** The gap region, or NULL if the pin cell has no gap */
+    BoundedRegion* _gap;
+    /** The cladding region, or NULL if the pin cell has no cladding */
+    BoundedRegion* _cladding;
+    /** The moderator region */
+    BoundedRegion* _moderator;
+    /** The surfaces bounding the regions */
+    std::vector<Surface*> _surfaces;
+
+    BoundedRegion* addRing(BoundedRegion* ring, float radius);
+
+public:
+    PinCell(float fuel_radius, float gap_radius, float cladding_radius,
+            float pitch, int num_fuel_rings=1,
+            const char* universe_name=(char*)"");
+    virtual ~PinCell();
+
+    float getPitch();
+    int getNumFuelRings();
+    BoundedRegion* getFuelRing(int ring);
+    BoundedRegion* getGap();
+    BoundedRegion* getCladding();
+    BoundedRegion* getModerator();
+
+    void setFuelMaterial(Material* material);
+    void setGapMaterial(Material* material);
+    void setCladdingMaterial(Material* material);
+    void setModeratorMaterial(Material* material);
+
+    BoundedRegion* findRegion(neutron* neutron);
+    BoundedRegion* findRegion(float x, float y, float z);
+};
+
+
+#endif /* PINCELL_H_ */
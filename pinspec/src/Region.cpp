@@ -21,7 +21,10 @@ Region::Region(const char* region_name) {
     _n++;
     _material = NULL;
     _volume = 1.0;
+    _volume_set = false;
+    _volume_uncertainty = 0.0;
     _buckling_squared = 0.0;
+    _temperature = 0.0;
 }
 
 
@@ -89,6 +92,27 @@ float Region::getVolume() {
 }
 
 
+/**
+ * @brief Returns whether or not the volume of the region has been set.
+ * @details The volume of a BOUNDED type region which has not been set is
+ *          estimated by its HETEROGENEOUS geometry when a simulation is run.
+ * @return true if the volume has been set, otherwise false
+ */
+bool Region::isVolumeSet() {
+    return _volume_set;
+}
+
+
+/**
+ * @brief Returns the uncertainty of the region's volume.
+ * @return the standard deviation of an estimated volume \f$ (cm^3) \f$,
+ *         or zero if the volume is exact
+ */
+float Region::getVolumeUncertainty() {
+    return _volume_uncertainty;
+}
+
+
 /**
  * @brief Returns the squared geometric buckling.
  * @return the geometric buckling squared
@@ -98,6 +122,21 @@ float Region::getBucklingSquared() {
 }
 
 
+/**
+ * @brief Returns the temperature of the region (K).
+ * @details If a temperature has not been set for the region, this is the
+ *          temperature of the material filling the region.
+ * @return the region's temperature
+ */
+float Region::getTemperature() {
+
+    if (_temperature > 0.0)
+        return _temperature;
+
+    return _material->getTemperature();
+}
+
+
 /**
  * @brief Computes and returns the total macroscopic cross-section in the region
  *        at some energy (eV).
@@ -105,7 +144,7 @@ float Region::getBucklingSquared() {
  * @return the total macroscopic cross-section \f$ (cm^{-1}) \f$
  */ 
 float Region::getTotalMacroXS(float energy) {
-    return _material->getTotalMacroXS(energy);
+    return _material->getTotalMacroXS(energy, getTemperature());
 }
 
 
@@ -149,7 +188,7 @@ float Region::getTotalMicroXS(int energy_index) {
  * @return the macroscopic elastic scattering cross-section \f$ (cm^{-1}) \f$
  */
 float Region::getElasticMacroXS(float energy) {
-    return _material->getElasticMacroXS(energy);
+    return _material->getElasticMacroXS(energy, getTemperature());
 }
 
 
@@ -193,7 +232,7 @@ float Region::getElasticMicroXS(int energy_index) {
  * @return the macroscopic absorpotion cross-section \f$ (cm^{-1}) \f$
  */
 float Region::getAbsorptionMacroXS(float energy) {
-    return _material->getAbsorptionMacroXS(energy);
+    return _material->getAbsorptionMacroXS(energy, getTemperature());
 }
 
 
@@ -237,7 +276,7 @@ float Region::getAbsorptionMicroXS(int energy_index) {
  * @return the macroscopic capture cross-section \f$ (cm^{-1}) \f$
  */
 float Region::getCaptureMacroXS(float energy) {
-    return _material->getCaptureMacroXS(energy);
+    return _material->getCaptureMacroXS(energy, getTemperature());
 }
 
 
@@ -281,7 +320,7 @@ float Region::getCaptureMicroXS(int energy_index) {
  * @return the macroscopic fission cross-section \f$ (cm^{-1}) \f$
  */
 float Region::getFissionMacroXS(float energy) {
-    return _material->getFissionMacroXS(energy);
+    return _material->getFissionMacroXS(energy, getTemperature());
 }
 
 
@@ -347,7 +386,7 @@ float Region::getTransportMicroXS(int energy_index) {
  * @return the macroscopic transport cross-section
  */
 float Region::getTransportMacroXS(float energy) {
-    return _material->getTransportMacroXS(energy);
+    return _material->getTransportMacroXS(energy, getTemperature());
 }
 
 
@@ -362,12 +401,96 @@ float Region::getTransportMacroXS(int energy_index) {
 }
 
 
+/**
+ * @brief Evaluates one of the region's macroscopic cross-sections at each
+ *        energy in a numpy array.
+ * @details The cross-sections are evaluated in parallel at the region's
+ *          temperature, and are NaN if the type of cross-section is unknown.
+ *          An example of how this function might be called in Python is as
+ *          follows:
+ *
+ * @code
+ *          energies = numpy.logspace(-2, 4, 1000000)
+ *          xs = region.evaluateMacroXS(energies, energies.size, 'total')
+ * @endcode
+ *
+ * @param energies an array of energies (eV)
+ * @param num_energies the number of energies
+ * @param xs an array to fill with the macroscopic cross-sections 
+ *        \f$ (cm^{-1}) \f$
+ * @param num_xs the number of cross-section values
+ * @param xs_type the type of cross-section (ie, 'capture')
+ */
+void Region::evaluateMacroXS(double* energies, int num_energies, float* xs,
+                             int num_xs, char* xs_type) {
+
+    if (_material == NULL) {
+        log_printf(ERROR, "Unable to evaluate the macro %s xs for region %s "
+                   "since it does not contain a material", xs_type, 
+                   _region_name);
+        return;
+    }
+
+    if (num_xs != num_energies) {
+        log_printf(ERROR, "Unable to evaluate the macro %s xs for region "
+                   "%s since the number of xs values is %d while the number "
+                   "of energies is %d", xs_type, _region_name, num_xs, 
+                   num_energies);
+        return;
+    }
+
+    xsType type = Isotope::getXSType(xs_type);
+
+    if (type == UNKNOWN_XS) {
+        std::fill(xs, xs + num_xs, std::numeric_limits<float>::quiet_NaN());
+        return;
+    }
+
+    /* Energies are passed in from numpy in double precision */
+    std::vector<float> float_energies(energies, energies + num_energies);
+
+    _material->evaluateMacroXS(type, float_energies.data(), xs, num_energies,
+                               getTemperature());
+}
+
+
+/**
+ * @brief Evaluates one of the region's microscopic cross-sections at each
+ *        energy in a numpy array.
+ * @details The microscopic cross-sections are the macroscopic 
+ *          cross-sections divided by the number density of the material
+ *          filling the region.
+ * @param energies an array of energies (eV)
+ * @param num_energies the number of energies
+ * @param xs an array to fill with the microscopic cross-sections 
+ * @param num_xs the number of cross-section values
+ * @param xs_type the type of cross-section (ie, 'capture')
+ */
+void Region::evaluateMicroXS(double* energies, int num_energies, float* xs,
+                             int num_xs, char* xs_type) {
+
+    evaluateMacroXS(energies, num_energies, xs, num_xs, xs_type);
+
+    if (_material == NULL || num_xs != num_energies)
+        return;
+
+    float number_density = _material->getMaterialNumberDensity();
+
+    for (int i=0; i < num_xs; i++)
+        xs[i] /= number_density;
+}
+
+
 /**
  * @brief Sets the volume for this region \f$ (cm^3) \f$.
  * @param volume the volume occuppied by this region
+ * @param uncertainty the standard deviation of an estimated volume, or zero
+ *        if the volume is exact (default)
  */
-void Region::setVolume(float volume) {
+void Region::setVolume(float volume, float uncertainty) {
     _volume = volume;
+    _volume_set = true;
+    _volume_uncertainty = uncertainty;
 
     if (_material != NULL)
         _material->incrementVolume(_volume);
@@ -385,6 +508,26 @@ void Region::setMaterial(Material* material) {
 }
 
 
+/**
+ * @brief Sets the temperature of the region (K).
+ * @details The region's temperature overrides the temperature of the
+ *          material filling it, such that many regions (ie, the rings of
+ *          a fuel pin) may share a material at different temperatures.
+ * @param temperature the region's temperature (K)
+ */
+void Region::setTemperature(float temperature) {
+
+    if (temperature <= 0.0) {
+        log_printf(ERROR, "Unable to set the temperature of region %s to "
+                   "%f K since the temperature must be positive", 
+                   _region_name, temperature);
+        return;
+    }
+
+    _temperature = temperature;
+}
+
+
 /**
  * @brief Sets the squared geometric buckling for the geometry.
  * @details This method also sets the bucklking squared for the material
@@ -426,6 +569,7 @@ void InfiniteMediumRegion::collideNeutron(neutron* neutron) {
 			" collide neutron", _region_name);
 
     /* Collide the neutron in the Region's Material */
+    neutron->_temperature = getTemperature();
     _material->collideNeutron(neutron);
     //    neutron->_path_length = 1.0 / neutron->_total_xs;
 
@@ -701,11 +845,14 @@ void EquivalenceRegion::collideNeutron(neutron* neutron) {
         /* If the test is larger than prob_ff, move to moderator */
         if (test > prob_ff) {
 	    neutron->_region = _other_region;
+            neutron->_temperature = _other_region->getTemperature();
             _other_region->getMaterial()->collideNeutron(neutron);
 	}
         /* Otherwise collide the neutron in the fuel's material */
-        else
+        else {
+            neutron->_temperature = getTemperature();
             _material->collideNeutron(neutron);
+        }
 
 	//        neutron->_path_length = 1.0 / neutron->_total_xs;
     }
@@ -718,11 +865,14 @@ void EquivalenceRegion::collideNeutron(neutron* neutron) {
         /* If the test is larger than prob_mf, move to fuel */
         if (test < prob_mf) {
 	    neutron->_region = _other_region;
+            neutron->_temperature = _other_region->getTemperature();
             _other_region->getMaterial()->collideNeutron(neutron);
 	}
         /* Otherwise collide the neutron in the moderator's material */
-        else
+        else {
+            neutron->_temperature = getTemperature();
 	    _material->collideNeutron(neutron);
+        }
 
 	//        neutron->_path_length = 1.0 / neutron->_total_xs;
     }
@@ -756,7 +906,12 @@ EquivalenceModeratorRegion::EquivalenceModeratorRegion(const char* region_name):
  * @brief BoundedRegion constructor.
  * @param region_name the name of the region 
  */
-BoundedRegion::BoundedRegion(const char* region_name): Region(region_name) { }
+BoundedRegion::BoundedRegion(const char* region_name): Region(region_name) {
+    _num_xplanes = 0;
+    _num_yplanes = 0;
+    _num_cylinders = 0;
+    _surfaces_grouped = false;
+}
 
 
 /**
@@ -775,6 +930,11 @@ void BoundedRegion::addBoundingSurface(int halfspace, Surface* surface) {
      * container for this region */
     std::pair<int, Surface*> pair=std::pair<int, Surface*>(halfspace, surface);
     _surfaces.push_back(pair);
+
+    /* The neighbors must be found and the surfaces grouped again for the 
+     * new surface */
+    _neighbors.clear();
+    _surfaces_grouped = false;
 }
 
 
@@ -794,8 +954,289 @@ void BoundedRegion::removeBoundingSurface(int halfspace, Surface* surface) {
 
     /* If the vector of bounding surfaces contains the halfspace/surface
      * pair, then remove it */
-    if (test != _surfaces.end())
+    if (test != _surfaces.end()) {
         _surfaces.erase(test);
+        _neighbors.clear();
+        _surfaces_grouped = false;
+    }
+}
+
+
+/**
+ * @brief Returns the number of halfspaces bounding this region.
+ * @return the number of bounding surfaces
+ */
+int BoundedRegion::getNumBoundingSurfaces() {
+    return _surfaces.size();
+}
+
+
+/**
+ * @brief Returns a bounding surface of this region.
+ * @param index the index of the bounding surface
+ * @return a pointer to the bounding surface
+ */
+Surface* BoundedRegion::getBoundingSurface(int index) {
+
+    if (index < 0 || index >= int(_surfaces.size())) {
+        log_printf(ERROR, "Unable to get bounding surface %d for region %s "
+                   "since it has %d bounding surfaces", index, _region_name,
+                   int(_surfaces.size()));
+        return NULL;
+    }
+
+    return _surfaces[index].second;
+}
+
+
+/**
+ * @brief Returns the halfspace (-1 or +1) of a bounding surface of this 
+ *        region.
+ * @param index the index of the bounding surface
+ * @return the halfspace of the bounding surface
+ */
+int BoundedRegion::getBoundingHalfspace(int index) {
+
+    if (index < 0 || index >= int(_surfaces.size())) {
+        log_printf(ERROR, "Unable to get bounding halfspace %d for region %s "
+                   "since it has %d bounding surfaces", index, _region_name,
+                   int(_surfaces.size()));
+        return 0;
+    }
+
+    return _surfaces[index].first;
+}
+
+
+/**
+ * @brief Removes all of the regions neighboring this region.
+ */
+void BoundedRegion::clearNeighbors() {
+    _neighbors.clear();
+    _neighbors.resize(_surfaces.size());
+}
+
+
+/**
+ * @brief Returns the halfspace of a surface which bounds this region.
+ * @param surface a pointer to the surface
+ * @return the halfspace (-1 or +1), or 0 if the surface does not bound 
+ *         this region
+ */
+int BoundedRegion::getHalfspace(Surface* surface) {
+
+    std::vector< std::pair<int, Surface*> >::iterator iter;
+    for (iter = _surfaces.begin(); iter != _surfaces.end(); ++iter) {
+        if ((*iter).second == surface)
+            return (*iter).first;
+    }
+
+    return 0;
+}
+
+
+/**
+ * @brief Adds a region on the other side of a bounding surface of this 
+ *        region.
+ * @details The neighbors are tested in the order they are added when a 
+ *          neutron crosses the surface. The neighbors must be cleared
+ *          with clearNeighbors() before the first neighbor is added. The
+ *          neighbor is compared with this region once here rather than 
+ *          each time a neutron crosses the surface. A neighbor which has
+ *          the opposite halfspace of another surface bounding this region,
+ *          or whose bounding box is apart from this region's bounding box,
+ *          can only contain a neutron leaving this region through a corner
+ *          and is not added (such neutrons are found by searching all of 
+ *          the regions). The neighbor's halfspace of the crossed surface is
+ *          never tested, and its halfspaces of surfaces which do not bound
+ *          this region are tested first since they are the most likely to 
+ *          exclude the neutron.
+ * @param surface a pointer to the bounding surface
+ * @param region a pointer to the region across the surface
+ */
+void BoundedRegion::addNeighbor(Surface* surface, BoundedRegion* region) {
+
+    if (_neighbors.size() != _surfaces.size()) {
+        log_printf(ERROR, "Unable to add a neighbor to region %s since its "
+                   "neighbors have not been cleared", _region_name);
+        return;
+    }
+
+    /* The tolerance (cm) for bounding boxes which touch */
+    float tolerance = 1E-3;
+    float x_min, x_max, y_min, y_max;
+    float other_x_min, other_x_max, other_y_min, other_y_max;
+
+    getBoundingBox(&x_min, &x_max, &y_min, &y_max);
+    region->getBoundingBox(&other_x_min, &other_x_max, &other_y_min, 
+                           &other_y_max);
+
+    if (x_max + tolerance < other_x_min || other_x_max + tolerance < x_min ||
+        y_max + tolerance < other_y_min || other_y_max + tolerance < y_min)
+        return;
+
+    regionNeighbor neighbor;
+    neighbor._region = region;
+    std::vector< std::pair<int, Surface*> > shared;
+
+    std::vector< std::pair<int, Surface*> >::iterator iter;
+    for (iter = region->_surfaces.begin(); iter != region->_surfaces.end(); 
+         ++iter) {
+
+        if ((*iter).second == surface)
+            continue;
+
+        int halfspace = getHalfspace((*iter).second);
+
+        if (halfspace == 0)
+            neighbor._halfspaces.push_back(*iter);
+        else if (halfspace == (*iter).first)
+            shared.push_back(*iter);
+        else
+            return;
+    }
+
+    neighbor._halfspaces.insert(neighbor._halfspaces.end(), shared.begin(),
+                                shared.end());
+
+    for (int i=0; i < int(_surfaces.size()); i++) {
+        if (_surfaces[i].second == surface)
+            _neighbors[i].push_back(neighbor);
+    }
+}
+
+
+/**
+ * @brief Returns the number of regions on the other side of a bounding 
+ *        surface of this region.
+ * @param surface a pointer to the bounding surface
+ * @return the number of neighbors across the surface
+ */
+int BoundedRegion::getNumNeighbors(Surface* surface) {
+
+    for (int i=0; i < int(_neighbors.size()); i++) {
+        if (_surfaces[i].second == surface)
+            return _neighbors[i].size();
+    }
+
+    return 0;
+}
+
+
+/**
+ * @brief Returns the regions on the other side of a bounding surface of
+ *        this region.
+ * @param index the index of the bounding surface
+ * @return a pointer to the neighbors across the surface, or NULL if the 
+ *         neighbors have not been found
+ */
+std::vector<regionNeighbor>* BoundedRegion::getNeighbors(int index) {
+
+    if (index < 0 || index >= int(_neighbors.size()))
+        return NULL;
+
+    return &_neighbors[index];
+}
+
+
+/**
+ * @brief Finds the region containing a neutron after it was moved by 
+ *        collideNeutron() within this region.
+ * @details The neutron's surface is the nearest bounding surface along its
+ *          trajectory. If the neutron is still on this region's side of the
+ *          surface, it collided (or was reflected) within this region. 
+ *          Otherwise, it crossed the surface and only the neighbors across
+ *          the surface are tested, each without its halfspace of the 
+ *          crossed surface.
+ * @param neutron the neutron of interest
+ * @return a pointer to this region or the neighbor containing the neutron,
+ *         or NULL if no neighbor contains the neutron
+ */
+BoundedRegion* BoundedRegion::findNextRegion(neutron* neutron) {
+
+    for (int i=0; i < int(_neighbors.size()); i++) {
+
+        if (_surfaces[i].second != neutron->_surface)
+            continue;
+
+        if (_surfaces[i].first * neutron->_surface->evaluate(neutron) > 0)
+            return this;
+
+        std::vector<regionNeighbor>::iterator iter;
+        for (iter = _neighbors[i].begin(); iter != _neighbors[i].end(); ++iter){
+
+            std::vector< std::pair<int, Surface*> >& halfspaces = 
+                                                      (*iter)._halfspaces;
+            bool contained = true;
+
+            for (int j=0; j < int(halfspaces.size()); j++) {
+                if (halfspaces[j].first * halfspaces[j].second->evaluate(neutron)
+                    < -1E-6) {
+                    contained = false;
+                    break;
+                }
+            }
+
+            if (contained)
+                return (*iter)._region;
+        }
+    }
+
+    return NULL;
+}
+
+
+/**
+ * @brief Computes an axis-aligned box in the xy-plane which bounds this region.
+ * @details The box is the intersection of the bounds from each halfspace: 
+ *          the positive or negative halfspace of an x- or y-plane bounds 
+ *          one side of the box and the inside of a cylinder bounds all four.
+ *          The sides which are not bounded by any halfspace are infinite.
+ * @param x_min a pointer to the minimum x-coordinate of the box
+ * @param x_max a pointer to the maximum x-coordinate of the box
+ * @param y_min a pointer to the minimum y-coordinate of the box
+ * @param y_max a pointer to the maximum y-coordinate of the box
+ */
+void BoundedRegion::getBoundingBox(float* x_min, float* x_max, float* y_min, 
+                                   float* y_max) {
+
+    float infinity = std::numeric_limits<float>::infinity();
+    *x_min = -infinity;
+    *x_max = infinity;
+    *y_min = -infinity;
+    *y_max = infinity;
+
+    std::vector< std::pair<int, Surface*> >::iterator iter;
+    for (iter = _surfaces.begin(); iter != _surfaces.end(); ++iter) {
+
+        int halfspace = (*iter).first;
+        Surface* surface = (*iter).second;
+
+        if (surface->getSurfaceType() == XPLANE) {
+            float x = static_cast<XPlane*>(surface)->getX();
+            if (halfspace > 0)
+                *x_min = std::max(*x_min, x);
+            else
+                *x_max = std::min(*x_max, x);
+        }
+
+        else if (surface->getSurfaceType() == YPLANE) {
+            float y = static_cast<YPlane*>(surface)->getY();
+            if (halfspace > 0)
+                *y_min = std::max(*y_min, y);
+            else
+                *y_max = std::min(*y_max, y);
+        }
+
+        else if (surface->getSurfaceType() == ZCYLINDER && halfspace < 0) {
+            ZCylinder* cylinder = static_cast<ZCylinder*>(surface);
+            float r = cylinder->getRadius();
+            *x_min = std::max(*x_min, cylinder->getX0() - r);
+            *x_max = std::min(*x_max, cylinder->getX0() + r);
+            *y_min = std::max(*y_min, cylinder->getY0() - r);
+            *y_max = std::min(*y_max, cylinder->getY0() + r);
+        }
+    }
 }
 
 
@@ -870,9 +1311,112 @@ bool BoundedRegion::onBoundary(neutron* neutron) {
 
 
 
+/**
+ * @brief Groups the coefficients of the bounding surfaces by surface type.
+ * @details The locations of the XPlanes and YPlanes and the centers and 
+ *          squared radii of the ZCylinders are each stored in contiguous
+ *          arrays, such that computeParametrizedDistance() may compute the
+ *          distances to all of the surfaces of each type in a loop without
+ *          a virtual call for each surface. The surfaces are not grouped if
+ *          any of them is of an unknown type, and must be grouped again if
+ *          any of the surfaces are moved or resized.
+ */
+void BoundedRegion::groupBoundingSurfaces() {
+
+    _surfaces_grouped = false;
+
+    std::vector<float> xplanes, yplanes, x0, y0, r_squared;
+    std::vector<int> xplane_indices, yplane_indices, cylinder_indices;
+
+    for (int i=0; i < int(_surfaces.size()); i++) {
+
+        Surface* surface = _surfaces[i].second;
+
+        switch (surface->getSurfaceType()) {
+
+            case XPLANE:
+                xplanes.push_back(static_cast<XPlane*>(surface)->getX());
+                xplane_indices.push_back(i);
+                break;
+
+            case YPLANE:
+                yplanes.push_back(static_cast<YPlane*>(surface)->getY());
+                yplane_indices.push_back(i);
+                break;
+
+            case ZCYLINDER: {
+                ZCylinder* cylinder = static_cast<ZCylinder*>(surface);
+                float radius = cylinder->getRadius();
+                x0.push_back(cylinder->getX0());
+                y0.push_back(cylinder->getY0());
+                r_squared.push_back(radius * radius);
+                cylinder_indices.push_back(i);
+                break;
+            }
+
+            default:
+                return;
+        }
+    }
+
+    _num_xplanes = xplanes.size();
+    _num_yplanes = yplanes.size();
+    _num_cylinders = r_squared.size();
+
+    _coefficients = xplanes;
+    _coefficients.insert(_coefficients.end(), yplanes.begin(), yplanes.end());
+    _coefficients.insert(_coefficients.end(), x0.begin(), x0.end());
+    _coefficients.insert(_coefficients.end(), y0.begin(), y0.end());
+    _coefficients.insert(_coefficients.end(), r_squared.begin(), 
+                         r_squared.end());
+
+    _grouped_indices = xplane_indices;
+    _grouped_indices.insert(_grouped_indices.end(), yplane_indices.begin(),
+                            yplane_indices.end());
+    _grouped_indices.insert(_grouped_indices.end(), cylinder_indices.begin(),
+                            cylinder_indices.end());
+
+    _surfaces_grouped = true;
+}
+
+
+/**
+ * @brief Returns whether the bounding surfaces have been grouped by type.
+ * @return true if the surfaces are grouped, otherwise false
+ */
+bool BoundedRegion::areSurfacesGrouped() {
+    return _surfaces_grouped;
+}
+
+
+/**
+ * @brief Updates the nearest bounding surface with the distance to one of 
+ *        the grouped surfaces.
+ * @details Ties are broken by the order in which the surfaces were added to
+ *          the region, such that the same surface is found as by querying 
+ *          each of the surfaces in turn.
+ * @param dist the distance to the surface
+ * @param index the index of the surface in the bounding surfaces
+ * @param min_dist a pointer to the minimum distance found thus far
+ * @param min_index a pointer to the index of the nearest surface thus far
+ */
+inline void BoundedRegion::findNearestSurface(float dist, int index,
+                                              float* min_dist, 
+                                              int* min_index) {
+
+    bool nearer = dist < *min_dist || (dist == *min_dist && index < *min_index);
+
+    *min_dist = nearer ? dist : *min_dist;
+    *min_index = nearer ? index : *min_index;
+}
+
+
 /**
  * @brief This method computes the parametrized distance along a neutron's 
  *        unit trajectory vector to the nearest bounding surface for this Region.
+ * @details If the bounding surfaces have been grouped by type, the distances
+ *          to the surfaces of each type are computed in a loop over their
+ *          coefficients without branches or virtual calls.
  * @param neutron the neutron of interest
  */
 float BoundedRegion::computeParametrizedDistance(neutron* neutron) {
@@ -880,6 +1424,42 @@ float BoundedRegion::computeParametrizedDistance(neutron* neutron) {
     float min_dist = std::numeric_limits<int>::max();
     float curr_dist;
 
+    if (_surfaces_grouped) {
+
+        float x = neutron->_x;
+        float y = neutron->_y;
+        float u = neutron->_u;
+        float v = neutron->_v;
+        int min_index = _surfaces.size();
+        const float* xplanes = _coefficients.data();
+        const float* yplanes = xplanes + _num_xplanes;
+        const float* x0 = yplanes + _num_yplanes;
+        const float* y0 = x0 + _num_cylinders;
+        const float* r_squared = y0 + _num_cylinders;
+        const int* indices = _grouped_indices.data();
+
+        for (int i=0; i < _num_xplanes; i++)
+            findNearestSurface(computePlaneDistance(x, u, xplanes[i]),
+                               indices[i], &min_dist, &min_index);
+
+        indices += _num_xplanes;
+        for (int i=0; i < _num_yplanes; i++)
+            findNearestSurface(computePlaneDistance(y, v, yplanes[i]),
+                               indices[i], &min_dist, &min_index);
+
+        indices += _num_yplanes;
+        for (int i=0; i < _num_cylinders; i++)
+            findNearestSurface(computeCylinderDistance(x, y, u, v, x0[i], 
+                                                       y0[i], r_squared[i]),
+                               indices[i], &min_dist, &min_index);
+
+        /* If no surface is ahead of the neutron, its surface is unchanged */
+        if (min_dist < std::numeric_limits<int>::max())
+            neutron->_surface = _surfaces[min_index].second;
+
+        return min_dist;
+    }
+
     /* Loop over and query all bounding surfaces */
     std::vector< std::pair<int, Surface*> >::iterator iter;
     for (iter = _surfaces.begin(); iter != _surfaces.end(); ++iter) {
@@ -902,6 +1482,11 @@ float BoundedRegion::computeParametrizedDistance(neutron* neutron) {
  * @brief This method collides a neutron within the region.
  * @details This method encapsulates all of the neutron scattering physics
  *          which is further encapsulated by the material and isotope classes.
+ *          Since each of the surfaces is independent of z, the distances to
+ *          the surfaces are computed in the xy-plane from the in-plane 
+ *          components of the neutron's trajectory. The trajectory is a unit
+ *          vector, so the parametrized distances along it are the path 
+ *          lengths in 3D without projecting them by the polar angle.
  * @param neutron the neutron of interest
  */
 void BoundedRegion::collideNeutron(neutron* neutron) {
@@ -910,9 +1495,10 @@ void BoundedRegion::collideNeutron(neutron* neutron) {
         log_printf(ERROR, "Region %s must have material to"
 			" collide neutron", _region_name);
 
+    neutron->_temperature = getTemperature();
+
     float path_length = _material->sampleDistanceTraveled(neutron);
-    float param_coll_dist = path_length / 
-                           norm3D<float>(neutron->_u, neutron->_v, neutron->_w);
+    float param_coll_dist = path_length;
     float param_surf_dist = computeParametrizedDistance(neutron);
 
     /* The neutron collided within this region */
@@ -934,12 +1520,8 @@ void BoundedRegion::collideNeutron(neutron* neutron) {
     /* The neutron crossed a bounding surface for this region */
     else {
 
-        /* Compute the path length to the surface */
-        float delta_x = neutron->_u * param_surf_dist;
-        float delta_y = neutron->_v * param_surf_dist;
-	float delta_z = neutron->_w * param_surf_dist;
-        path_length = norm3D<float>(delta_x, delta_y, delta_z);
-        neutron->_path_length = path_length;
+        /* The path length to the surface */
+        neutron->_path_length = param_surf_dist;
 
         /* The neutron crossed an INTERFACE type surface, so we "bump" 
 	 * it across the surface with a tiny "nudge" */
@@ -999,8 +1581,8 @@ BoundedFuelRegion::BoundedFuelRegion(const char* region_name):
  * 
  */
 void BoundedFuelRegion::ringify(int num_rings) {
-    log_printf(ERROR, "Ringify is not yet implemented for BOUNDED_FUEL type "
-	       "regions.");
+    log_printf(ERROR, "Ringify is not implemented for BOUNDED_FUEL type "
+	       "regions. Use a PinCell with %d fuel rings instead.", num_rings);
     return;
 }
 
@@ -1023,8 +1605,8 @@ BoundedModeratorRegion::BoundedModeratorRegion(const char* region_name):
  *
  */
 void BoundedModeratorRegion::ringify(int num_rings) {
-    log_printf(ERROR, "Ringify is not yet implemented for BOUNDED_MODERATOR "
-	       "type regions.");
+    log_printf(ERROR, "Ringify is not implemented for BOUNDED_MODERATOR "
+	       "type regions. Use a PinCell instead.");
     return;
 }
 
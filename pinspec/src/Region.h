@@ -72,6 +72,14 @@ protected:
     float _buckling_squared;
     /** The volume occupied by the region in 2D space */
     float _volume;
+    /** Whether or not the volume has been set */
+    bool _volume_set;
+    /** The standard deviation of an estimated volume, or zero if the volume
+     *  is exact */
+    float _volume_uncertainty;
+    /** The temperature of the region (K), or zero if the region takes the
+     * temperature of its material */
+    float _temperature;
 
 public:
     Region(const char* region_name=(char*)"");
@@ -85,7 +93,10 @@ public:
     bool containsIsotope(Isotope* isotope);
     regionType getRegionType();
     float getVolume();
+    bool isVolumeSet();
+    float getVolumeUncertainty();
     float getBucklingSquared();
+    float getTemperature();
 
     float getTotalMacroXS(float energy);
     float getTotalMacroXS(int energy_index);
@@ -117,9 +128,18 @@ public:
     float getTransportMacroXS(float energy);
     float getTransportMacroXS(int energy_index);
 
+    /* IMPORTANT: The following two class method prototypes must not be 
+     * changed without changing Geometry.i to allow for the data arrays to be 
+     * transformed into numpy arrays */
+    void evaluateMacroXS(double* energies, int num_energies, float* xs, 
+                         int num_xs, char* xs_type);
+    void evaluateMicroXS(double* energies, int num_energies, float* xs, 
+                         int num_xs, char* xs_type);
+
     void setMaterial(Material* material);
-    void setVolume(float volume);
+    void setVolume(float volume, float uncertainty=0.0);
     void setBucklingSquared(float buckling_squared);
+    void setTemperature(float temperature);
 
     /**
      * @brief This method collides a neutron within the region.
@@ -266,6 +286,26 @@ public:
 };
 
 
+class BoundedRegion;
+
+
+/**
+ * @struct regionNeighbor
+ * @brief A region on the other side of a bounding surface of a BoundedRegion.
+ * @details A neutron which crossed the surface is known to be on the 
+ *          neighbor's side of it, so the neighbor's halfspace of the crossed
+ *          surface is not tested to find if the neighbor contains the 
+ *          neutron.
+ */
+struct regionNeighbor {
+    /** A pointer to the region across the surface */
+    BoundedRegion* _region;
+    /** The halfspaces of the region which must be tested, beginning with
+     *  those which do not also bound the BoundedRegion */
+    std::vector< std::pair<int, Surface*> > _halfspaces;
+};
+
+
 /**
  * @class BoundedRegion Region.h "pinspec/src/Region.h"
  * @brief The BoundedRegion is a region bounded by surfaces using a constructive
@@ -280,6 +320,29 @@ class BoundedRegion: public Region {
 private:
     /** A container of pointers to the surfaces bounding this region */
     std::vector< std::pair<int, Surface*> > _surfaces;
+    /** The regions on the other side of each bounding surface, in the same
+     *  order as the bounding surfaces */
+    std::vector< std::vector<regionNeighbor> > _neighbors;
+    /** Whether the bounding surfaces have been grouped by type */
+    bool _surfaces_grouped;
+    /** The number of bounding XPlanes */
+    int _num_xplanes;
+    /** The number of bounding YPlanes */
+    int _num_yplanes;
+    /** The number of bounding ZCylinders */
+    int _num_cylinders;
+    /** The coefficients of the bounding surfaces grouped by type: the 
+     *  locations of the XPlanes and of the YPlanes, followed by the 
+     *  x-coordinates of the centers, the y-coordinates of the centers and 
+     *  the squared radii of the ZCylinders */
+    std::vector<float> _coefficients;
+    /** The indices into the bounding surfaces of the XPlanes, YPlanes and
+     *  ZCylinders, in the order in which they are grouped */
+    std::vector<int> _grouped_indices;
+
+    int getHalfspace(Surface* surface);
+    void findNearestSurface(float dist, int index, float* min_dist,
+                            int* min_index);
 
 public:
     BoundedRegion(const char* region_name=(char*)"");
@@ -289,6 +352,18 @@ public:
     virtual ~BoundedRegion() { };
     void addBoundingSurface(int halfspace, Surface* surface);
     void removeBoundingSurface(int halfspace, Surface* surface);
+    int getNumBoundingSurfaces();
+    Surface* getBoundingSurface(int index);
+    int getBoundingHalfspace(int index);
+    void clearNeighbors();
+    void addNeighbor(Surface* surface, BoundedRegion* region);
+    int getNumNeighbors(Surface* surface);
+    std::vector<regionNeighbor>* getNeighbors(int index);
+    void groupBoundingSurfaces();
+    bool areSurfacesGrouped();
+    BoundedRegion* findNextRegion(neutron* neutron);
+    void getBoundingBox(float* x_min, float* x_max, float* y_min, 
+                        float* y_max);
 
     bool contains(neutron* neutron);
     bool contains(float x, float y, float z);
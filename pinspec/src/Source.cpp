@@ -0,0 +1,308 @@
+#include "Source.h"
+
+
+/**
+ * @brief Source constructor.
+ * @details The source defaults to the Watt spectrum used by the Fissioner.
+ */
+Source::Source() {
+
+    _num_bins = 0;
+    _bin_edges = NULL;
+    _alias_probs = NULL;
+    _aliases = NULL;
+    _energy = 0.0;
+
+    setWattSpectrum();
+}
+
+
+/**
+ * @brief Source destructor deletes the alias table for a tabulated spectrum.
+ */
+Source::~Source() {
+    clearTabulatedSpectrum();
+}
+
+
+/**
+ * @brief Returns the type of the source energy spectrum.
+ * @return the source type
+ */
+sourceType Source::getSourceType() const {
+    return _source_type;
+}
+
+
+/**
+ * @brief Returns the parameter \f$ a \f$ of the Watt spectrum.
+ * @return the Watt spectrum parameter \f$ a \f$ (MeV)
+ */
+float Source::getWattA() const {
+    return _watt_a;
+}
+
+
+/**
+ * @brief Returns the parameter \f$ b \f$ of the Watt spectrum.
+ * @return the Watt spectrum parameter \f$ b \f$ (1/MeV)
+ */
+float Source::getWattB() const {
+    return _watt_b;
+}
+
+
+/**
+ * @brief Returns the energy of a monoenergetic source.
+ * @return the source energy (eV)
+ */
+float Source::getEnergy() const {
+    return _energy;
+}
+
+
+/**
+ * @brief Returns the number of bins in a tabulated source spectrum.
+ * @return the number of bins
+ */
+int Source::getNumBins() const {
+    return _num_bins;
+}
+
+
+/**
+ * @brief Sets the source to a Watt fission spectrum.
+ * @details The default parameters are those of the Watt spectrum given in
+ *          "Fundamentals of Nuclear Reactor Physics", E. E. Lewis.
+ * @param a the Watt spectrum parameter \f$ a \f$ (MeV)
+ * @param b the Watt spectrum parameter \f$ b \f$ (1/MeV)
+ */
+void Source::setWattSpectrum(float a, float b) {
+
+    if (a <= 0.0 || b < 0.0) {
+        log_printf(ERROR, "Unable to set a Watt spectrum with a = %f MeV "
+                   "and b = %f 1/MeV since a must be positive and b must be "
+                   "non-negative", a, b);
+        return;
+    }
+
+    clearTabulatedSpectrum();
+    _source_type = WATT_SOURCE;
+    _watt_a = a;
+    _watt_b = b;
+}
+
+
+/**
+ * @brief Sets the source to the Watt fission spectrum of an isotope.
+ * @details The Watt spectrum parameters for thermal neutron induced fission
+ *          are used for U-233, U-235 and Pu-239, and those for 1 MeV neutron
+ *          induced fission are used for Th-232 and U-238.
+ * @param isotope a fissionable isotope
+ */
+void Source::setChiSpectrum(Isotope* isotope) {
+
+    char* name = isotope->getIsotopeName();
+
+    if (!strcmp(name, "U-233"))
+        setWattSpectrum(0.977, 2.546);
+    else if (!strcmp(name, "U-235"))
+        setWattSpectrum(0.988, 2.249);
+    else if (!strcmp(name, "Pu-239"))
+        setWattSpectrum(0.966, 2.842);
+    else if (!strcmp(name, "Th-232"))
+        setWattSpectrum(1.0888, 1.6871);
+    else if (!strcmp(name, "U-238"))
+        setWattSpectrum(0.88111, 3.4005);
+    else
+        log_printf(ERROR, "Unable to set the source to the chi spectrum of "
+                   "isotope %s since its Watt spectrum parameters are not "
+                   "known", name);
+}
+
+
+/**
+ * @brief Sets the source to emit neutrons at a single energy.
+ * @param energy the source energy (eV)
+ */
+void Source::setMonoenergetic(float energy) {
+
+    if (energy <= 0.0) {
+        log_printf(ERROR, "Unable to set a monoenergetic source with energy "
+                   "%f eV since the energy must be positive", energy);
+        return;
+    }
+
+    clearTabulatedSpectrum();
+    _source_type = MONOENERGETIC_SOURCE;
+    _energy = energy;
+}
+
+
+/**
+ * @brief Sets the source to a spectrum tabulated on a set of energy bins.
+ * @details The spectrum is taken to be constant within each bin, such that
+ *          the probability of a bin is its spectrum value multiplied by its
+ *          width. The bins are sampled from an alias table in constant time
+ *          for any number of bins. A user may call this method from within
+ *          Python as follows:
+ *
+ * @code
+ *          energies = numpy.array([1E5, 1E6, 2E6, 1E7])
+ *          spectrum = numpy.array([0.1, 0.5, 0.05])
+ *          source.setTabulatedSpectrum(energies, spectrum)
+ * @endcode
+ *
+ * @param energies the energies (eV) of the edges of the bins
+ * @param num_energies the number of energies
+ * @param spectrum the spectrum value in each bin (per eV)
+ * @param num_values the number of spectrum values
+ */
+void Source::setTabulatedSpectrum(double* energies, int num_energies,
+                                  double* spectrum, int num_values) {
+
+    if (num_values != num_energies - 1 || num_values < 1) {
+        log_printf(ERROR, "Unable to set a tabulated source spectrum with %d "
+                   "values and %d bin edges since there must be one more "
+                   "bin edge than the number of values", num_values,
+                   num_energies);
+        return;
+    }
+
+    /* Compute the probability of each bin */
+    std::vector<double> probs(num_values);
+    double total = 0.0;
+
+    for (int i=0; i < num_values; i++) {
+
+        if (energies[i+1] <= energies[i] || energies[i] < 0.0 ||
+            spectrum[i] < 0.0) {
+            log_printf(ERROR, "Unable to set a tabulated source spectrum "
+                       "since the bin edges must be non-negative and "
+                       "increasing and the spectrum must be non-negative");
+            return;
+        }
+
+        probs[i] = spectrum[i] * (energies[i+1] - energies[i]);
+        total += probs[i];
+    }
+
+    if (total <= 0.0) {
+        log_printf(ERROR, "Unable to set a tabulated source spectrum since "
+                   "the spectrum is zero in every bin");
+        return;
+    }
+
+    clearTabulatedSpectrum();
+    _source_type = TABULATED_SOURCE;
+    _num_bins = num_values;
+    _bin_edges = new float[num_values+1];
+    _alias_probs = new float[num_values];
+    _aliases = new int[num_values];
+
+    for (int i=0; i <= num_values; i++)
+        _bin_edges[i] = energies[i];
+
+    /* Build the alias table with Vose's method: each bin with less than
+     * the average probability is filled up by the alias of a bin with more
+     * than the average probability */
+    std::vector<int> small;
+    std::vector<int> large;
+
+    for (int i=0; i < num_values; i++) {
+        probs[i] *= num_values / total;
+        _aliases[i] = i;
+
+        if (probs[i] < 1.0)
+            small.push_back(i);
+        else
+            large.push_back(i);
+    }
+
+    while (!small.empty() && !large.empty()) {
+
+        int less = small.back();
+        int more = large.back();
+        small.pop_back();
+
+        _alias_probs[less] = probs[less];
+        _aliases[less] = more;
+        probs[more] -= 1.0 - probs[less];
+
+        if (probs[more] < 1.0) {
+            large.pop_back();
+            small.push_back(more);
+        }
+    }
+
+    /* The remaining bins are full up to round-off */
+    for (size_t i=0; i < small.size(); i++)
+        _alias_probs[small[i]] = 1.0;
+    for (size_t i=0; i < large.size(); i++)
+        _alias_probs[large[i]] = 1.0;
+}
+
+
+/**
+ * @brief Deletes the alias table for a tabulated spectrum.
+ */
+void Source::clearTabulatedSpectrum() {
+
+    if (_bin_edges != NULL) {
+        delete [] _bin_edges;
+        delete [] _alias_probs;
+        delete [] _aliases;
+    }
+
+    _bin_edges = NULL;
+    _alias_probs = NULL;
+    _aliases = NULL;
+    _num_bins = 0;
+}
+
+
+/**
+ * @brief Samples an energy from a Watt spectrum.
+ * @details An energy \f$ W \f$ is first sampled from a Maxwellian spectrum
+ *          with temperature \f$ a \f$, and the energy is then:
+ *
+ *          \f$ E = W + \frac{a^2b}{4} + (2\xi - 1)\sqrt{a^2bW} \f$
+ *
+ * @param a the Watt spectrum parameter \f$ a \f$ (MeV)
+ * @param b the Watt spectrum parameter \f$ b \f$ (1/MeV)
+ * @return a neutron energy (MeV)
+ */
+float Source::sampleWatt(float a, float b) {
+
+    /* Random numbers on (0, 1] for the logarithms */
+    double xi1 = (rand() + 1.0) / (RAND_MAX + 1.0);
+    double xi2 = (rand() + 1.0) / (RAND_MAX + 1.0);
+    double cosine = cos(M_PI / 2.0 * rand() / RAND_MAX);
+
+    double maxwell = -a * (log(xi1) + log(xi2) * cosine * cosine);
+
+    double xi3 = double(rand()) / RAND_MAX;
+
+    return maxwell + a * a * b / 4.0 +
+           (2.0 * xi3 - 1.0) * sqrt(a * a * b * maxwell);
+}
+
+
+/**
+ * @brief Samples an array of source neutron energies.
+ * @details This is a helper function for users to sample many source
+ *          energies from Python at the speed of C++. A user may call this
+ *          method from within Python as follows:
+ *
+ * @code
+ *          energies = source.sampleEnergies(1000000)
+ * @endcode
+ *
+ * @param samples an array to fill with the sampled energies (eV)
+ * @param num_samples the number of energies to sample
+ */
+void Source::sampleEnergies(float* samples, int num_samples) {
+
+    for (int i=0; i < num_samples; i++)
+        samples[i] = sampleEnergy();
+}
@@ -0,0 +1,131 @@
+/**
+ * @file Source.h
+ * @brief The Source class.
+ * @date October 18, 2026
+ */
+
+#ifndef SOURCE_H_
+#define SOURCE_H_
+
+#ifdef __cplusplus
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include <algorithm>
+#include "log.h"
+#include "Isotope.h"
+#endif
+
+
+/**
+ * @enum sourceTypes
+ * @brief The types of energy spectra for source neutrons.
+ */
+
+/**
+ * @var sourceType
+ * @brief A type of energy spectrum for source neutrons.
+ */
+typedef enum sourceTypes {
+    /** A Watt fission spectrum */
+    WATT_SOURCE,
+    /** A single energy */
+    MONOENERGETIC_SOURCE,
+    /** A histogram spectrum tabulated on a set of energy bins */
+    TABULATED_SOURCE
+} sourceType;
+
+
+/**
+ * @class Source Source.h "pinspec/src/Source.h"
+ * @brief The Source samples the energies of source neutrons.
+ * @details Each type of spectrum is sampled in constant time. The Watt
+ *          spectrum:
+ *
+ *          \f$ \chi(E) \propto exp(-E/a) sinh(\sqrt{bE}) \f$
+ *
+ *          is sampled directly from a Maxwellian with temperature \f$ a \f$
+ *          as described in "Monte Carlo Sampler" (LA-9721-MS, 1983). The
+ *          bins of a tabulated spectrum are sampled from an alias table
+ *          built with Vose's method, and the energy is then sampled
+ *          uniformly within the bin. By default the source is the Watt
+ *          spectrum given in "Fundamentals of Nuclear Reactor Physics",
+ *          E. E. Lewis, which is the spectrum used by the Fissioner:
+ *
+ *          \f$ \chi = 0.453 * exp(-1.036E) * sinh(\sqrt{2.29E}) \f$
+ */
+class Source {
+
+private:
+    /** The type of source energy spectrum */
+    sourceType _source_type;
+    /** The Watt spectrum parameter \f$ a \f$ (MeV) */
+    float _watt_a;
+    /** The Watt spectrum parameter \f$ b \f$ (1/MeV) */
+    float _watt_b;
+    /** The energy (eV) of a monoenergetic source */
+    float _energy;
+    /** The number of bins in a tabulated spectrum */
+    int _num_bins;
+    /** The energies (eV) of the edges of the bins in a tabulated spectrum */
+    float* _bin_edges;
+    /** The probability of keeping each bin in the alias table */
+    float* _alias_probs;
+    /** The alias of each bin in the alias table */
+    int* _aliases;
+
+    void clearTabulatedSpectrum();
+
+public:
+    Source();
+    virtual ~Source();
+
+    sourceType getSourceType() const;
+    float getWattA() const;
+    float getWattB() const;
+    float getEnergy() const;
+    int getNumBins() const;
+
+    void setWattSpectrum(float a=0.965251, float b=2.29);
+    void setChiSpectrum(Isotope* isotope);
+    void setMonoenergetic(float energy);
+
+    /* IMPORTANT: The following two class method prototypes must not be
+     * changed without changing Geometry.i to allow for the data arrays to be
+     * transformed into numpy arrays */
+    void setTabulatedSpectrum(double* energies, int num_energies,
+                              double* spectrum, int num_values);
+    void sampleEnergies(float* samples, int num_samples);
+
+    static float sampleWatt(float a, float b);
+    float sampleEnergy() const;
+};
+
+
+/**
+ * @brief Samples a source neutron energy from the source spectrum.
+ * @return a neutron energy (eV)
+ */
+inline float Source::sampleEnergy() const {
+
+    if (_source_type == WATT_SOURCE)
+        return sampleWatt(_watt_a, _watt_b) * 1E6;
+
+    else if (_source_type == MONOENERGETIC_SOURCE)
+        return _energy;
+
+    /* Sample a bin from the alias table and an energy within the bin */
+    int bin = std::min(int(float(rand()) / RAND_MAX * _num_bins), 
+                       _num_bins - 1);
+
+    if (float(rand()) / RAND_MAX > _alias_probs[bin])
+        bin = _aliases[bin];
+
+    float fraction = float(rand()) / RAND_MAX;
+
+    return _bin_edges[bin] + fraction * (_bin_edges[bin+1] - _bin_edges[bin]);
+}
+
+
+#endif /* SOURCE_H_ */
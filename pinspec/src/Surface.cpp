@@ -81,6 +81,7 @@ void Surface::setBoundaryType(boundaryType type) {
  * @details Assigns a default value of x=0 for the x-axis intersection point.
  */
 XPlane::XPlane(const char* surface_name) : Surface(surface_name) {
+    _surface_type = XPLANE;
     _x = 0.0;
 };
 
@@ -154,17 +155,9 @@ float XPlane::evaluate(float x, float y, float z) {
  */
 float XPlane::computeParametrizedDistance(neutron* neutron) {
 
-    /* Set dist to infinity to begin with */
-    float dist = std::numeric_limits<int>::max();
-    float x = neutron->_x;
-    float u = neutron->_u;
-
-    /* If the neutron is traveling towards the surface, return the distance */
-    if ((x - _x < -1E-6 && u > 0.0) || (x - _x > 1E-6 && u < 0.0))
-        dist = (_x - x) / u;
-
-    /* If the neutron is not traveling towards the surface, return infinity */
-    return dist;
+    /* If the neutron is not traveling towards the surface, the distance is
+     * infinity */
+    return computePlaneDistance(neutron->_x, neutron->_u, _x);
 }
 
 
@@ -205,6 +198,7 @@ void XPlane::reflectNeutron(neutron* neutron) {
  * @details Assigns a default value of y=0 for the y-axis intersection point.
  */
 YPlane::YPlane(const char* surface_name) : Surface(surface_name) {
+    _surface_type = YPLANE;
     _y = 0.0;
 };
 
@@ -278,17 +272,9 @@ float YPlane::evaluate(float x, float y, float z) {
  */
 float YPlane::computeParametrizedDistance(neutron* neutron) {
 
-    /* Set dist to infinity to begin with */
-    float dist = std::numeric_limits<int>::max();
-    float y = neutron->_y;
-    float v = neutron->_v;
-
-    /* If the neutron is traveling towards the surface, return the distance */
-    if ((y - _y < -1E-6 && v > 0.0) || (y - _y > 1E-6 && v < 0.0))
-        dist = (_y - y) / v;
-
-    /* If the neutron is not traveling towards the surface, return infinity */
-    return dist;
+    /* If the neutron is not traveling towards the surface, the distance is
+     * infinity */
+    return computePlaneDistance(neutron->_y, neutron->_v, _y);
 }
 
 
@@ -329,6 +315,7 @@ void YPlane::reflectNeutron(neutron* neutron) {
  *          and a radius of 0.
  */
 ZCylinder::ZCylinder(const char* surface_name) : Surface(surface_name) {
+    _surface_type = ZCYLINDER;
     _x0 = 0;
     _y0 = 0;
     _r = 0;
@@ -437,57 +424,8 @@ float ZCylinder::evaluate(float x, float y, float z) {
  * @return the parametrized distance to the surface along the neutron's trajectory
  */
 float ZCylinder::computeParametrizedDistance(neutron* neutron) {
-
-    float x = neutron->_x;
-    float y = neutron->_y;
-    float u = neutron->_u;
-    float v = neutron->_v;
-
-    float r_squared = x*x + y*y;
-
-    /* Compute temporary variables for each term in the quadratic equation */
-    float a = u*u + v*v;
-    float b = 2.0*x*u - 2.0*_x0*u + 2.0*y*v - 2.0*_y0*v;
-    float c = r_squared + _x0*_x0 - 2.0*_x0*x + _y0*_y0 - 2.0*_y0*y 
-                  - _r_squared;
-
-    /* Compute the discriminant in the quadratic formula */
-    float discr = b*b - 4.0*a*c;
-
-    /* There is not an intersection point */
-    if (discr < 0.0)
-        return std::numeric_limits<int>::max();
-
-    /* There is one intersection point */
-    else if (discr == 0.0) {
-
-        float dist = -b / (2.0*a);
-
-        if (dist > 0.0)
-            return dist;
-        else
-            return std::numeric_limits<int>::max();
-    }
-
-    /* There are two intersection points */
-    else {
-        discr = sqrt(discr);
-        float dist1 = (-b + discr) / (2.0*a);
-        float dist2 = (-b - discr) / (2.0*a);
-
-        if (dist1 < 0.0 && dist2 < 0.0)
-            return std::numeric_limits<int>::max();
-
-        /* Determine which distance is shorter */
-        if (dist1 > 0.0 && dist2 < 0.0)
-	    return dist1;
-	else if (dist2 > 0.0 && dist1 < 0.0)
-	    return dist2;
-        else if (dist1 < dist2 && dist1 > 0.0)
-	    return dist1;
-	else
-	    return dist2;
-    }
+    return computeCylinderDistance(neutron->_x, neutron->_y, neutron->_u,
+                                   neutron->_v, _x0, _y0, _r_squared);
 }
 
 
@@ -514,6 +452,14 @@ bool ZCylinder::onSurface(neutron* neutron) {
 
 /**
  * @brief Perfectly reflects a neutron at a cylinder.
+ * @details The in-plane component of the neutron's trajectory along the 
+ *          vector \f$ \hat{n} \f$ normal to the cylinder at the neutron's 
+ *          location is reversed: 
+ *
+ *          \f$ \vec{\Omega}' = \vec{\Omega} - 2(\vec{\Omega} \cdot \hat{n})
+ *               \hat{n} \f$
+ *
+ *          which preserves the length of the trajectory vector.
  * @param neutron the neutron of interest
  */
 void ZCylinder::reflectNeutron(neutron* neutron) {
@@ -522,24 +468,17 @@ void ZCylinder::reflectNeutron(neutron* neutron) {
      * neutron's trajectory and the cylinder */
     float x1 = neutron->_x - _x0;
     float y1 = neutron->_y - _y0;
-   
-    /* Compute the unit vector of the neutron's trajectory */
-    float u = neutron->_u;
-    float v = neutron->_v;
-
-    /* Compute the angle between the two vectors at the reflection point on 
-     *the cylinder's surface */
-    float theta = acos(dotProduct2D(x1, y1, u, v) 
-			/ (norm2D(x1, y1) * norm2D(u, v)));
-
-    /* Reflect the particle around the vector normal to the cylinder surface */
-    float rotation_angle = M_PI - 2.0 * theta;
-
-    /* Update the neutron's trajectory vector using the 2D rotation matrix */
-    neutron->_u = neutron->_u * cos(rotation_angle) -
-                  neutron->_v * sin(rotation_angle);
-    neutron->_v = neutron->_u * sin(rotation_angle) +
-                  neutron->_v * cos(rotation_angle);
+    float norm_squared = x1 * x1 + y1 * y1;
+
+    if (norm_squared == 0.0)
+        return;
+
+    /* Reverse the component of the trajectory along the normal vector */
+    float projection = 2.0 * dotProduct2D(x1, y1, neutron->_u, neutron->_v) / 
+                       norm_squared;
+
+    neutron->_u -= projection * x1;
+    neutron->_v -= projection * y1;
 
     return;
 }
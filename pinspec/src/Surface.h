@@ -10,6 +10,7 @@
 
 #include <limits>
 #include <math.h>
+#include <algorithm>
 #include "log.h"
 #include "vector.h"
 #include "Neutron.h"
@@ -43,6 +44,73 @@ typedef enum surfaceTypes {
 } surfaceType;
 
 
+/**
+ * @brief Computes the parametrized distance along a neutron's trajectory to
+ *        a plane perpendicular to an axis.
+ * @details This kernel is shared by the XPlane and YPlane and by the 
+ *          BoundedRegion, which calls it for each of its planes without
+ *          a virtual call. It is written without branches such that loops
+ *          over planes may be vectorized.
+ * @param position the neutron's coordinate along the axis
+ * @param direction the component of the neutron's trajectory along the axis
+ * @param plane the location of the plane along the axis
+ * @return the parametrized distance, or infinity if the neutron is not 
+ *         traveling towards the plane
+ */
+inline float computePlaneDistance(float position, float direction, 
+                                  float plane) {
+
+    float delta = plane - position;
+    bool towards = (delta > 1E-6 && direction > 0.0) || 
+                   (delta < -1E-6 && direction < 0.0);
+
+    return towards ? delta / direction : std::numeric_limits<int>::max();
+}
+
+
+/**
+ * @brief Computes the parametrized distance along a neutron's trajectory to
+ *        a cylinder parallel to the z-axis.
+ * @details This kernel is shared by the ZCylinder and by the BoundedRegion, 
+ *          which calls it for each of its cylinders without a virtual call.
+ *          The quadratic equation for the intersection points is solved 
+ *          relative to the cylinder's center and the nearest intersection
+ *          point ahead of the neutron is selected without branches.
+ * @param x the x-coordinate of the neutron
+ * @param y the y-coordinate of the neutron
+ * @param u the x-component of the neutron's trajectory
+ * @param v the y-component of the neutron's trajectory
+ * @param x0 the x-coordinate of the cylinder's center
+ * @param y0 the y-coordinate of the cylinder's center
+ * @param r_squared the square of the cylinder's radius
+ * @return the parametrized distance, or infinity if the neutron's 
+ *         trajectory does not intersect the cylinder ahead of it
+ */
+inline float computeCylinderDistance(float x, float y, float u, float v,
+                                     float x0, float y0, float r_squared) {
+
+    float dx = x - x0;
+    float dy = y - y0;
+
+    /* Compute temporary variables for each term in the quadratic equation */
+    float a = u*u + v*v;
+    float b = 2.0 * (dx*u + dy*v);
+    float c = dx*dx + dy*dy - r_squared;
+    float discr = b*b - 4.0*a*c;
+
+    /* The nearer and farther intersection points */
+    float root = sqrt(std::max(discr, 0.0f));
+    float half_inv_a = 0.5 / a;
+    float dist1 = (-b - root) * half_inv_a;
+    float dist2 = (-b + root) * half_inv_a;
+    float dist = (dist1 > 0.0) ? dist1 : dist2;
+
+    bool intersects = discr >= 0.0 && a > 0.0 && dist > 0.0;
+
+    return intersects ? dist : std::numeric_limits<int>::max();
+}
+
+
 /**
  * @enum boundaryTypes
  * @brief Boundary condition types
@@ -43,6 +43,9 @@ Tally::Tally(char* tally_name) {
     _num_edges = 0;
     _computed_statistics = false;
     _group_expand_bins = true;
+
+    /* Tallies are made in each lattice cell by default */
+    _lattice_cell = -1;
 }
 
 
@@ -441,6 +444,16 @@ bool Tally::hasExpandedGroupBins() {
 }
 
 
+/**
+ * @brief Returns the lattice cell to which the tally is restricted.
+ * @return the index of the lattice cell, or -1 if the tally is made in
+ *         each lattice cell
+ */
+int Tally::getLatticeCell() {
+    return _lattice_cell;
+}
+
+
 /**
  * @brief Returns whether or not the tally precision meets the 
  *        precision trigger threshold, if a trigger exists.
@@ -749,6 +762,29 @@ void Tally::setGroupExpandBins(bool expand_bins) {
 }
 
 
+/**
+ * @brief Restricts the tally to neutrons in one cell of the geometry's 
+ *        lattice.
+ * @details Since the regions of a universe are shared between each of the
+ *          lattice cells it fills, a region tally is made in each of those
+ *          cells unless it is restricted to one of them. Lattice cells are
+ *          indexed from the lower left corner of the lattice along the x-axis
+ *          and then along the y-axis.
+ * @param cell the index of the lattice cell, or -1 to tally in each cell
+ */
+void Tally::setLatticeCell(int cell) {
+
+    if (cell < -1) {
+        log_printf(ERROR, "Unable to restrict tally %s to lattice cell %d "
+                   "since the cell index must be non-negative or -1",
+                   _tally_name, cell);
+        return;
+    }
+
+    _lattice_cell = cell;
+}
+
+
 /**
  * @brief Sets a precision trigger for this tally.
  * @details By setting a precision trigger, the user instructs a PINSEPC
@@ -928,6 +964,9 @@ void Tally::tally(neutron* neutron, double weight) {
         return;
     }
 
+    if (_lattice_cell >= 0 && neutron->_cell != _lattice_cell)
+        return;
+
     int bin_index = getBinIndex(neutron->_old_energy);
 
     /* For outscattering reaction rates, we do nothing if the neutrons 
@@ -967,6 +1006,9 @@ void Tally::tallyGroup(neutron* neutron, double weight) {
         return;
     }
 
+    if (_lattice_cell >= 0 && neutron->_cell != _lattice_cell)
+        return;
+
     /* Obtains the index corresponding to neutron's incoming energy (old_index)
      * and outgoing energy (new_index) */
     int old_index = getBinIndex(neutron->_old_energy);
@@ -1383,6 +1425,7 @@ Tally* Tally::clone() {
     tally->setTallyDomainType(_tally_domain);
     tally->setBinSpacingType(_bin_spacing);
     tally->setPrecisionTrigger(_trigger_type, _trigger_precision);
+    tally->setLatticeCell(_lattice_cell);
 
     if (_num_edges != _num_bins+1)
         tally->setGroupExpandBins(false);
@@ -3137,7 +3180,8 @@ Tally* createTally(Geometry* geometry, tallyType tally_type, char* tally_name) {
  * @param neutron the neutron of interest
  */
 void IsotopeCollisionRateTally::tally(neutron* neutron) {
-    double weight = _isotope->getTotalXS(neutron->_old_energy)
+    double weight = _isotope->getTotalXS(neutron->_old_energy,
+                                         neutron->_temperature)
       * neutron->_path_length;
     Tally::tally(neutron, weight);
     return;
@@ -3187,7 +3231,8 @@ void GeometryCollisionRateTally::tally(neutron* neutron) {
  * @param neutron the neutron of interest
  */
 void IsotopeElasticRateTally::tally(neutron* neutron) {
-    double weight = _isotope->getElasticXS(neutron->_old_energy)
+    double weight = _isotope->getElasticXS(neutron->_old_energy,
+                                           neutron->_temperature)
       * neutron->_path_length;
     Tally::tally(neutron, weight);
     return;
@@ -3200,7 +3245,8 @@ void IsotopeElasticRateTally::tally(neutron* neutron) {
  * @param neutron the neutron of interest
  */
 void MaterialElasticRateTally::tally(neutron* neutron) {
-    double weight = _material->getElasticMacroXS(neutron->_old_energy) 
+    double weight = _material->getElasticMacroXS(neutron->_old_energy,
+                                                 neutron->_temperature) 
       * neutron->_path_length;
     Tally::tally(neutron, weight);
     return;
@@ -3241,7 +3287,8 @@ void GeometryElasticRateTally::tally(neutron* neutron) {
  * @param neutron the neutron of interest
  */
 void IsotopeGroupRateTally::tally(neutron* neutron) {
-    double weight = _isotope->getElasticXS(neutron->_old_energy)
+    double weight = _isotope->getElasticXS(neutron->_old_energy,
+                                           neutron->_temperature)
       * neutron->_path_length;
     Tally::tallyGroup(neutron, weight);
     return;
@@ -3254,7 +3301,8 @@ void IsotopeGroupRateTally::tally(neutron* neutron) {
  * @param neutron the neutron of interest
  */
 void MaterialGroupRateTally::tally(neutron* neutron) {
-    double weight = _material->getElasticMacroXS(neutron->_old_energy) 
+    double weight = _material->getElasticMacroXS(neutron->_old_energy,
+                                                 neutron->_temperature) 
 			* neutron->_path_length;
     Tally::tallyGroup(neutron, weight);
     return;
@@ -3295,7 +3343,8 @@ void GeometryGroupRateTally::tally(neutron* neutron) {
  * @param neutron the neutron of interest
  */
 void IsotopeOutScatterRateTally::tally(neutron* neutron) {
-    double weight = _isotope->getElasticXS(neutron->_old_energy)
+    double weight = _isotope->getElasticXS(neutron->_old_energy,
+                                           neutron->_temperature)
 			* neutron->_path_length;
     Tally::tally(neutron, weight);
     return;
@@ -3308,7 +3357,8 @@ void IsotopeOutScatterRateTally::tally(neutron* neutron) {
  * @param neutron the neutron of interest
  */
 void MaterialOutScatterRateTally::tally(neutron* neutron) {
-    double weight = _material->getElasticMacroXS(neutron->_old_energy) 
+    double weight = _material->getElasticMacroXS(neutron->_old_energy,
+                                                 neutron->_temperature) 
 			* neutron->_path_length;
     Tally::tally(neutron, weight);
     return;
@@ -3350,7 +3400,8 @@ void GeometryOutScatterRateTally::tally(neutron* neutron) {
  * @param neutron the neutron of interest
  */
 void IsotopeAbsorptionRateTally::tally(neutron* neutron) {
-    double weight = _isotope->getAbsorptionXS(neutron->_old_energy) 
+    double weight = _isotope->getAbsorptionXS(neutron->_old_energy,
+                                              neutron->_temperature) 
 			* neutron->_path_length;
     Tally::tally(neutron, weight);
     return;
@@ -3363,7 +3414,8 @@ void IsotopeAbsorptionRateTally::tally(neutron* neutron) {
  * @param neutron the neutron of interest
  */
 void MaterialAbsorptionRateTally::tally(neutron* neutron) {
-    double weight = _material->getAbsorptionMacroXS(neutron->_old_energy) 
+    double weight = _material->getAbsorptionMacroXS(neutron->_old_energy,
+                                                    neutron->_temperature) 
 			* neutron->_path_length;
     Tally::tally(neutron, weight);
     return;
@@ -3405,7 +3457,8 @@ void GeometryAbsorptionRateTally::tally(neutron* neutron) {
  * @param neutron the neutron of interest
  */
 void IsotopeCaptureRateTally::tally(neutron* neutron) {
-    double weight = _isotope->getCaptureXS(neutron->_old_energy) 
+    double weight = _isotope->getCaptureXS(neutron->_old_energy,
+                                           neutron->_temperature) 
 			* neutron->_path_length;
     Tally::tally(neutron, weight);
     return;
@@ -3418,7 +3471,8 @@ void IsotopeCaptureRateTally::tally(neutron* neutron) {
  * @param neutron the neutron of interest
  */
 void MaterialCaptureRateTally::tally(neutron* neutron) {
-    double weight = _material->getCaptureMacroXS(neutron->_old_energy) 
+    double weight = _material->getCaptureMacroXS(neutron->_old_energy,
+                                                 neutron->_temperature) 
  			* neutron->_path_length;
     Tally::tally(neutron, weight);
     return;
@@ -3461,7 +3515,8 @@ void GeometryCaptureRateTally::tally(neutron* neutron) {
  * @param neutron the neutron of interest
  */
 void IsotopeFissionRateTally::tally(neutron* neutron) {
-    double weight = _isotope->getFissionXS(neutron->_old_energy)
+    double weight = _isotope->getFissionXS(neutron->_old_energy,
+                                           neutron->_temperature)
       * neutron->_path_length;
     Tally::tally(neutron, weight);
     return;
@@ -3474,7 +3529,8 @@ void IsotopeFissionRateTally::tally(neutron* neutron) {
  * @param neutron the neutron of interest
  */
 void MaterialFissionRateTally::tally(neutron* neutron) {
-    double weight = _material->getFissionMacroXS(neutron->_old_energy) 
+    double weight = _material->getFissionMacroXS(neutron->_old_energy,
+                                                 neutron->_temperature) 
 			* neutron->_path_length;
     Tally::tally(neutron, weight);
     return;
@@ -3516,7 +3572,8 @@ void GeometryFissionRateTally::tally(neutron* neutron) {
  * @param neutron the neutron of interest
  */
 void IsotopeTransportRateTally::tally(neutron* neutron) {
-    double weight = _isotope->getTransportXS(neutron->_old_energy) 
+    double weight = _isotope->getTransportXS(neutron->_old_energy,
+                                             neutron->_temperature) 
 			* neutron->_path_length;
     Tally::tally(neutron, weight);
     return;
@@ -3529,7 +3586,8 @@ void IsotopeTransportRateTally::tally(neutron* neutron) {
  * @param neutron the neutron of interest
  */
 void MaterialTransportRateTally::tally(neutron* neutron) {
-    double weight = _material->getTransportMacroXS(neutron->_old_energy) 
+    double weight = _material->getTransportMacroXS(neutron->_old_energy,
+                                                   neutron->_temperature) 
 		     * neutron->_path_length;
     Tally::tally(neutron, weight);
     return;
@@ -3572,7 +3630,10 @@ void GeometryTransportRateTally::tally(neutron* neutron) {
  * @param neutron the neutron of interest
  */
 void IsotopeDiffusionRateTally::tally(neutron* neutron) {
-    double weight = 1.0 / (3.0 * _isotope->getTransportXS(neutron->_old_energy))  		         * neutron->_path_length;
+    double weight = 1.0 / (3.0 * 
+                           _isotope->getTransportXS(neutron->_old_energy,
+                                                    neutron->_temperature))
+                    * neutron->_path_length;
     Tally::tally(neutron, weight);
     return;
 }
@@ -3586,7 +3647,8 @@ void IsotopeDiffusionRateTally::tally(neutron* neutron) {
  */
 void MaterialDiffusionRateTally::tally(neutron* neutron) {
     double weight = 1.0 / (3.0 * 
-			   _material->getTransportMacroXS(neutron->_old_energy)) 
+			   _material->getTransportMacroXS(neutron->_old_energy,
+                                                  neutron->_temperature)) 
 			* neutron->_path_length;
     Tally::tally(neutron, weight);
     return;
@@ -3635,7 +3697,8 @@ void GeometryDiffusionRateTally::tally(neutron* neutron) {
  */
 void MaterialLeakageRateTally::tally(neutron* neutron) {
     double weight = _material->getBucklingSquared() * neutron->_path_length / 
-                 (3.0 * _material->getTransportMacroXS(neutron->_old_energy));
+                 (3.0 * _material->getTransportMacroXS(neutron->_old_energy,
+                                                       neutron->_temperature));
     Tally::tally(neutron, weight);
     return;
 }
@@ -211,6 +211,8 @@ protected:
     bool _computed_statistics;
     /** Whether or not bin size has be squared for group-to-group xs */
     bool _group_expand_bins;
+    /** The lattice cell to which tallies are restricted, or -1 for all */
+    int _lattice_cell;
 
 public:
     Tally(char* tally_name=(char*)"");
@@ -239,6 +241,7 @@ public:
     triggerType getTriggerType();
     bool hasComputedBatchStatistics();
     bool hasExpandedGroupBins();
+    int getLatticeCell();
 
     /* IMPORTANT: The following six class method prototypes must not be changed
      * without changing Geometry.i to allow for the data arrays to be 
@@ -261,6 +264,7 @@ public:
     void setBinSpacingType(binSpacingType type);
     void setBinEdges(double* edges, int num_edges);
     void setGroupExpandBins(bool expand_bins);
+    void setLatticeCell(int cell);
     void setPrecisionTrigger(triggerType trigger_type, float precision);
     void generateBinEdges(double start, double end, int num_bins,
                           binSpacingType type);
@@ -655,6 +655,80 @@ void TallyBank::tally(neutron* neutron) {
 }
 
 
+/**
+ * @brief Returns the tallies registered for each geometry, in the order in
+ *        which a neutron is tallied in them.
+ * @return a vector of the geometry tallies
+ */
+std::vector<Tally*> TallyBank::getGeometryTallies() {
+
+    std::vector<Tally*> tallies;
+    std::map<Geometry*, std::set<Tally*>* >::iterator iter;
+
+    for (iter = _geometry_tallies.begin(); iter != _geometry_tallies.end(); 
+         ++iter)
+        tallies.insert(tallies.end(), (*iter).second->begin(), 
+                       (*iter).second->end());
+
+    return tallies;
+}
+
+
+/**
+ * @brief Returns the tallies registered for a region.
+ * @param region a pointer to the region of interest
+ * @return a vector of the region's tallies
+ */
+std::vector<Tally*> TallyBank::getRegionTallies(Region* region) {
+
+    std::vector<Tally*> tallies;
+    std::map<Region*, std::set<Tally*>* >::iterator iter;
+
+    iter = _region_tallies.find(region);
+
+    if (iter != _region_tallies.end())
+        tallies.assign((*iter).second->begin(), (*iter).second->end());
+
+    return tallies;
+}
+
+
+/**
+ * @brief Returns the tallies registered for each material.
+ * @return a map of each material to its tallies
+ */
+std::map< Material*, std::vector<Tally*> > TallyBank::getMaterialTallies() {
+
+    std::map< Material*, std::vector<Tally*> > tallies;
+    std::map<Material*, std::set<Tally*>* >::iterator iter;
+
+    for (iter = _material_tallies.begin(); iter != _material_tallies.end(); 
+         ++iter)
+        tallies[(*iter).first].assign((*iter).second->begin(), 
+                                      (*iter).second->end());
+
+    return tallies;
+}
+
+
+/**
+ * @brief Returns the tallies registered for each isotope.
+ * @return a map of each isotope to its tallies
+ */
+std::map< Isotope*, std::vector<Tally*> > TallyBank::getIsotopeTallies() {
+
+    std::map< Isotope*, std::vector<Tally*> > tallies;
+    std::map<Isotope*, std::set<Tally*>* >::iterator iter;
+
+    for (iter = _isotope_tallies.begin(); iter != _isotope_tallies.end(); 
+         ++iter)
+        tallies[(*iter).first].assign((*iter).second->begin(), 
+                                      (*iter).second->end());
+
+    return tallies;
+}
+
+
 /**
  * @brief Initializes each registered tally with some number of batches for
  *        batch-based statistics.
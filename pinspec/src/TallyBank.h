@@ -11,6 +11,7 @@
 #ifdef __cplusplus
 #include <set>
 #include <map>
+#include <vector>
 #include <utility>
 #include <string.h>
 #include <sstream>
@@ -99,6 +100,11 @@ public:
     void outputBatchStatistics();
     void tally(neutron* neutron);
 
+    std::vector<Tally*> getGeometryTallies();
+    std::vector<Tally*> getRegionTallies(Region* region);
+    std::map< Material*, std::vector<Tally*> > getMaterialTallies();
+    std::map< Isotope*, std::vector<Tally*> > getIsotopeTallies();
+
     void clearTallies();
 };
 
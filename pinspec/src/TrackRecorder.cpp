@@ -0,0 +1,187 @@
+#include "TrackRecorder.h"
+
+
+/**
+ * @brief TrackRecorder constructor allocates the buffers for the points.
+ * @param max_points the number of points which may be recorded
+ * @param decimation the number of collisions or crossings per recorded
+ *        point (default is 1)
+ */
+TrackRecorder::TrackRecorder(int max_points, int decimation) {
+
+    if (max_points < 0) {
+        log_printf(ERROR, "Unable to create a track recorder for %d points "
+                   "since the number of points is negative", max_points);
+        max_points = 0;
+    }
+
+    if (decimation < 1) {
+        log_printf(ERROR, "Unable to create a track recorder with a "
+                   "decimation of %d since it must be at least 1",
+                   decimation);
+        decimation = 1;
+    }
+
+    _max_points = max_points;
+    _num_points = 0;
+    _num_tracks = 0;
+    _decimation = decimation;
+
+    _x.resize(max_points);
+    _y.resize(max_points);
+    _z.resize(max_points);
+    _energies.resize(max_points);
+    _region_uids.resize(max_points);
+    _events.resize(max_points);
+    _tracks.resize(max_points);
+}
+
+
+/**
+ * @brief Empty destructor lets SWIG delete the recorder during garbage
+ *        collection.
+ */
+TrackRecorder::~TrackRecorder() { }
+
+
+/**
+ * @brief Returns the number of points which may be recorded.
+ * @return the maximum number of points
+ */
+int TrackRecorder::getMaxPoints() {
+    return _max_points;
+}
+
+
+/**
+ * @brief Returns the number of points which have been recorded.
+ * @return the number of points
+ */
+int TrackRecorder::getNumPoints() {
+    return _num_points;
+}
+
+
+/**
+ * @brief Returns the number of tracks which have been recorded.
+ * @details The last track may have been truncated if the recorder is full.
+ * @return the number of tracks
+ */
+int TrackRecorder::getNumTracks() {
+    return _num_tracks;
+}
+
+
+/**
+ * @brief Returns the number of collisions or crossings per recorded point.
+ * @return the decimation
+ */
+int TrackRecorder::getDecimation() {
+    return _decimation;
+}
+
+
+/**
+ * @brief Returns whether or not the recorder is full.
+ * @return true if no more points may be recorded, otherwise false
+ */
+bool TrackRecorder::isFull() {
+    return (_num_points == _max_points);
+}
+
+
+/**
+ * @brief Ends the current track, such that the following points are
+ *        recorded for the next track.
+ */
+void TrackRecorder::endTrack() {
+    _num_tracks++;
+}
+
+
+/**
+ * @brief Discards the recorded points and tracks.
+ */
+void TrackRecorder::clear() {
+    _num_points = 0;
+    _num_tracks = 0;
+}
+
+
+/**
+ * @brief Copies the global x-coordinates of the points into an array.
+ * @param data the array of x-coordinates
+ * @param num_points the number of points to copy
+ */
+void TrackRecorder::retrieveX(float* data, int num_points) {
+    std::copy(_x.begin(), _x.begin() + std::min(num_points, _num_points),
+              data);
+}
+
+
+/**
+ * @brief Copies the global y-coordinates of the points into an array.
+ * @param data the array of y-coordinates
+ * @param num_points the number of points to copy
+ */
+void TrackRecorder::retrieveY(float* data, int num_points) {
+    std::copy(_y.begin(), _y.begin() + std::min(num_points, _num_points),
+              data);
+}
+
+
+/**
+ * @brief Copies the z-coordinates of the points into an array.
+ * @param data the array of z-coordinates
+ * @param num_points the number of points to copy
+ */
+void TrackRecorder::retrieveZ(float* data, int num_points) {
+    std::copy(_z.begin(), _z.begin() + std::min(num_points, _num_points),
+              data);
+}
+
+
+/**
+ * @brief Copies the neutron's energy leaving each point into an array.
+ * @param data the array of energies (eV)
+ * @param num_points the number of points to copy
+ */
+void TrackRecorder::retrieveEnergies(float* data, int num_points) {
+    std::copy(_energies.begin(),
+              _energies.begin() + std::min(num_points, _num_points), data);
+}
+
+
+/**
+ * @brief Copies the unique identifiers of the region of each point into an
+ *        array.
+ * @param data the array of region unique identifiers
+ * @param num_points the number of points to copy
+ */
+void TrackRecorder::retrieveRegionUids(int* data, int num_points) {
+    std::copy(_region_uids.begin(),
+              _region_uids.begin() + std::min(num_points, _num_points), data);
+}
+
+
+/**
+ * @brief Copies the event at each point into an array.
+ * @param data the array of events (SOURCE, COLLISION, CROSSING, ABSORPTION
+ *        or LEAKAGE)
+ * @param num_points the number of points to copy
+ */
+void TrackRecorder::retrieveEvents(int* data, int num_points) {
+    std::copy(_events.begin(),
+              _events.begin() + std::min(num_points, _num_points), data);
+}
+
+
+/**
+ * @brief Copies the index of the track of each point into an array.
+ * @param data the array of track indices
+ * @param num_points the number of points to copy
+ */
+void TrackRecorder::retrieveTracks(int* data, int num_points) {
+    std::copy(_tracks.begin(),
+              _tracks.begin() + std::min(num_points, _num_points), data);
+}
@@ -0,0 +1,145 @@
+/**
+ * @file TrackRecorder.h
+ * @brief The TrackRecorder class.
+ * @date October 18, 2026
+ */
+
+#ifndef TRACKRECORDER_H_
+#define TRACKRECORDER_H_
+
+#ifdef __cplusplus
+#include <vector>
+#include <algorithm>
+#include "log.h"
+#endif
+
+
+/**
+ * @enum trackEvents
+ * @brief The events at which the points of a neutron's track are recorded
+ */
+
+/**
+ * @var trackEvent
+ * @brief An event at a point of a neutron's track
+ */
+typedef enum trackEvents {
+    /** The neutron was emitted at a source site */
+    SOURCE,
+    /** The neutron scattered */
+    COLLISION,
+    /** The neutron crossed or was reflected from a surface */
+    CROSSING,
+    /** The neutron was absorbed */
+    ABSORPTION,
+    /** The neutron leaked from the geometry or was lost */
+    LEAKAGE
+} trackEvent;
+
+
+/**
+ * @class TrackRecorder TrackRecorder.h "pinspec/src/TrackRecorder.h"
+ * @brief A TrackRecorder stores the points along the tracks of neutrons
+ *        transported through a HETEROGENEOUS geometry.
+ * @details The position, energy, region and event at each point are stored
+ *          in buffers which are allocated for a fixed number of points when
+ *          the recorder is created, and the points of each track are stored
+ *          contiguously in the order of the track. Only every n-th collision
+ *          or crossing of a track is recorded for a decimation of n, while
+ *          the source site and the end of each track are always recorded.
+ *          Each buffer is retrieved as a numpy array from within Python as
+ *          follows:
+ *
+ * @code
+ *          recorder = TrackRecorder(100000)
+ *          geometry.recordTracks(recorder, 1000)
+ *          num_points = recorder.getNumPoints()
+ *          x = recorder.retrieveX(num_points)
+ *          y = recorder.retrieveY(num_points)
+ *          tracks = recorder.retrieveTracks(num_points)
+ * @endcode
+ */
+class TrackRecorder {
+
+private:
+    /** The number of points which may be recorded */
+    int _max_points;
+    /** The number of points which have been recorded */
+    int _num_points;
+    /** The number of tracks which have been recorded */
+    int _num_tracks;
+    /** The number of collisions or crossings per recorded point */
+    int _decimation;
+    /** The global x-coordinate of each point */
+    std::vector<float> _x;
+    /** The global y-coordinate of each point */
+    std::vector<float> _y;
+    /** The z-coordinate of each point */
+    std::vector<float> _z;
+    /** The neutron's energy (eV) leaving each point */
+    std::vector<float> _energies;
+    /** The unique identifier of the region of each point, or zero if the
+     *  neutron was not within a region */
+    std::vector<int> _region_uids;
+    /** The event at each point */
+    std::vector<int> _events;
+    /** The index of the track of each point */
+    std::vector<int> _tracks;
+
+public:
+    TrackRecorder(int max_points, int decimation=1);
+    virtual ~TrackRecorder();
+
+    int getMaxPoints();
+    int getNumPoints();
+    int getNumTracks();
+    int getDecimation();
+    bool isFull();
+
+    void recordPoint(float x, float y, float z, float energy, int region_uid,
+                     trackEvent event);
+    void endTrack();
+    void clear();
+
+    /* IMPORTANT: The following seven class method prototypes must not be
+     * changed without changing Geometry.i to allow for the data arrays to be
+     * transformed into numpy arrays */
+    void retrieveX(float* data, int num_points);
+    void retrieveY(float* data, int num_points);
+    void retrieveZ(float* data, int num_points);
+    void retrieveEnergies(float* data, int num_points);
+    void retrieveRegionUids(int* data, int num_points);
+    void retrieveEvents(int* data, int num_points);
+    void retrieveTracks(int* data, int num_points);
+};
+
+
+/**
+ * @brief Records a point along the current track.
+ * @details The point is not recorded if the recorder is full.
+ * @param x the global x-coordinate of the point
+ * @param y the global y-coordinate of the point
+ * @param z the z-coordinate of the point
+ * @param energy the neutron's energy (eV) leaving the point
+ * @param region_uid the unique identifier of the region of the point
+ * @param event the event at the point
+ */
+inline void TrackRecorder::recordPoint(float x, float y, float z,
+                                       float energy, int region_uid,
+                                       trackEvent event) {
+
+    if (_num_points == _max_points)
+        return;
+
+    _x[_num_points] = x;
+    _y[_num_points] = y;
+    _z[_num_points] = z;
+    _energies[_num_points] = energy;
+    _region_uids[_num_points] = region_uid;
+    _events[_num_points] = event;
+    _tracks[_num_points] = _num_tracks;
+    _num_points++;
+}
+
+
+#endif /* TRACKRECORDER_H_ */
@@ -52,6 +52,9 @@ typedef enum integrationSchemes {
 /**
  * @brief Performs a cumulative numerical integral over arrays of x and y 
           values using the specificed integration method.
+ * @details The trapezoidal rule is additive so its cumulative integral is
+ *          accumulated in a single pass. The other schemes integrate each
+ *          prefix of the arrays separately.
  * @param x the the x values
  * @param y the y values
  * @param cdf the array of cdf values at each value of x and y
@@ -62,6 +65,24 @@ template <typename T, typename U>
 void cumulativeIntegral(T* x, T* y, U* cdf, int length, 
 			integrationScheme scheme) {
 
+    /* Calculate cumulative integral with a running sum */
+    if (scheme == TRAPEZOIDAL) {
+
+        double integral = 0;
+        double delta_x = 0;
+
+        if (length > 0)
+            cdf[0] = 0;
+
+        for (int i=1; i < length; i++) {
+            delta_x = x[i] - x[i-1];
+            integral += delta_x * (y[i] + y[i-1]) / 2.0;
+            cdf[i] = (U)integral;
+        }
+
+        return;
+    }
+
     /* Calculate cumulative integral */
     for (int i=1; i < length+1; i++)
         cdf[i-1] = (U)integrate(x, y, i, scheme);
@@ -105,4 +105,60 @@ P linearInterp(T* x, T* y, int length, U pt) {
 }
 
 
+/**
+ * @brief This function takes in the x and y values of a 1D function and 
+ *        linearly interpolates the y values at an array of x-coordinates.
+ * @details Both the x values and the x-coordinates to interpolate must be
+ *          ordered from least to greatest. Rather than a binary search for 
+ *          each point, the two arrays are swept together in a single pass 
+ *          such that the cost is linear in the total number of values. The 
+ *          interpolated values are identical to those from linearInterp.
+ * @param x vector of x values
+ * @param y vector of y values
+ * @param length the number of x and y
+ * @param pts the x-coordinates we wish to interpolate
+ * @param y_pts the array to fill with the interpolated y values
+ * @param num_pts the number of x-coordinates
+ */
+template <typename T, typename U, typename P>
+void linearInterpSorted(T* x, T* y, int length, U* pts, P* y_pts, 
+                        int num_pts) {
+
+    int index = 1;
+
+    /* If the length given is less than zero, exit program */
+    if (length <= 0)
+        exit(1);
+
+    for (int i=0; i < num_pts; i++) {
+
+        /* If the length is exactly 1 then return the only y value */
+        if (length == 1)
+            y_pts[i] = y[0];
+
+        /* If the pt is outside of the x values, return the y corresponding 
+         * to the nearest x value */
+        else if (pts[i] <= x[0])
+            y_pts[i] = y[0];
+
+        else if (pts[i] >= x[length-1])
+            y_pts[i] = y[length-1];
+
+        /* Otherwise advance to the first x which is not less than pt */
+        else {
+            while (x[index] < pts[i])
+                index++;
+
+            /* Find the slope of the line between the two sandwich points */
+            double m = (y[index] - y[index-1]) / (x[index] - x[index-1]);
+
+            /* Compute the interpolated point using the point-slope formula */
+            y_pts[i] = m * (pts[i] - x[index]) + y[index];
+        }
+    }
+
+    return;
+}
+
+
 #endif /* INTERPOLATE_H_ */
@@ -10,6 +10,39 @@
 static std::string _xs_directory = "pinspec/xs-lib/";
 
 
+/**
+ * @struct xsIndexEntry
+ * @brief An entry in the cross-section library index for one data file.
+ */
+struct xsIndexEntry {
+    /** The number of data points in the file */
+    int _num_points;
+    /** The FNV-1a checksum of the file contents */
+    unsigned int _checksum;
+};
+
+
+/**
+ * @var _xs_index
+ * @brief The cross-section library index keyed by "<isotope>-<xs_type>".
+ * @details The index is read from the index.txt file in the cross-section 
+ *          library directory the first time it is needed.
+ */
+static std::map<std::string, xsIndexEntry> _xs_index;
+
+/**
+ * @var _xs_index_loaded
+ * @brief Whether the index has been read for the current library directory
+ */
+static bool _xs_index_loaded = false;
+
+/**
+ * @var _xs_index_found
+ * @brief Whether the current library directory has an index.txt file
+ */
+static bool _xs_index_found = false;
+
+
 /**
  * @brief Sets the directory for the cross-section library.
  * @param xs_directory character array for the cross-section library directory
@@ -19,6 +52,11 @@ void setXSLibDirectory(const char* xs_directory) {
     _xs_directory = xs_directory;
     log_printf(INFO, "Set the cross-section library directory "
                         "to: %s", _xs_directory.c_str());
+
+    /* The index for the new directory is read the next time it is needed */
+    _xs_index.clear();
+    _xs_index_loaded = false;
+
     return;
 }
 
@@ -32,76 +70,1021 @@ const char* getXSLibDirectory() {
 }
 
 
+/**
+ * @var _xs_overrides
+ * @brief In-memory cross-section data which take precedence over the data
+ *        files in the cross-section library.
+ * @details Each entry is keyed by the same "<isotope>-<xs_type>" stem used to
+ *          name the data files in the cross-section library and holds a pair
+ *          of arrays for the energies (eV) and cross-section values (barns).
+ *          Since overrides are never written to disk, the cross-section 
+ *          library itself is never modified and may be safely shared by 
+ *          concurrent PINSPEC jobs.
+ */
+static std::map< std::string, std::pair< std::vector<float>, 
+                               std::vector<float> > > _xs_overrides;
+
+
+/**
+ * @brief Returns the key for an isotope's cross-section in the override 
+ *        registry.
+ * @param isotope the name of the isotope (ie, 'U-238')
+ * @param xs_type the cross-section type ('elastic', 'capture' or 'fission')
+ * @return the key for the cross-section
+ */
+static std::string getXSOverrideKey(const char* isotope, const char* xs_type) {
+    return std::string(isotope) + "-" + xs_type;
+}
+
+
 /**
  * @brief Restores the cross-section library to its original, installed state.
- * @details This function copies the original cross-section data files installed
- *          with PINSPEC from the pinspec/xs-lib/BackupXS folder into the main
- *          cross-section library directory pinspec/xs-lib. This function is
- *          primarily when a user is using PINSPEC's SLBW module to create
- *          artifical cross-sections from Reich-Moore date. This function is
- *          called anytime the python pinspec module is imported. 
- * @return returns an int representing whether or not the copy was successful
+ * @details Cross-sections generated from within PINSPEC (ie, by the SLBW
+ *          module) are stored in an in-memory override registry rather than
+ *          written to the cross-section library. This function clears all
+ *          overrides such that any isotopes which are subsequently loaded
+ *          will use the data files installed with PINSPEC. 
+ * @return returns 0 since the library on disk is never modified
  */
 int restoreXSLibrary() {
-    std::string cmd = std::string("cp ") + _xs_directory + 
-                                                "/BackupXS/* " + _xs_directory;
-    int ret = system(cmd.c_str());
-    return ret;
+    clearXSOverrides();
+    return 0;
 }
 
 
 /**
- * @brief Parses an input file of cross-section data
- * @details Loads the energy values (as eV) and the cross-section values 
- *          (barns) into two float arrays. It takes in the energies in MeV
-            since that is the most typical unit for ENDF nuclear data, but 
-            converts the values into eV during parsing.
- * @param file the filename for the data
- * @param energies a pointer to a float array for the energies (MeV)
- * @param xs_values a pointer to a float array fo the xs values (barns)
- * @return the number of data points
+ * @brief Registers a cross-section which overrides the data in the 
+ *        cross-section library for an isotope.
+ * @details Any isotope which loads this cross-section type after the override
+ *          has been set will use this data rather than the data file in the 
+ *          cross-section library. A user may call this function from within 
+ *          Python as follows:
+ *
+ * @code
+ *          energies = numpy.array([1E-3, 0.1, 1., 10., 1000.])
+ *          xs = numpy.array([1000., 1000., 10., 1., 0.1])
+ *          setXSOverride('U-238', 'capture', energies, xs)
+ *          u238.loadXS('capture')
+ * @endcode
+ *
+ * @param isotope the name of the isotope (ie, 'U-238')
+ * @param xs_type the cross-section type ('elastic', 'capture' or 'fission')
+ * @param energies an array of energy values (eV)
+ * @param num_energies the number of energy values
+ * @param xs_values an array of cross-section values (barns)
+ * @param num_xs the number of cross-section values
  */
-int parseCrossSections(const char* file, float* energies, float* xs_values) {
+void setXSOverride(const char* isotope, const char* xs_type, 
+                   double* energies, int num_energies, 
+                   double* xs_values, int num_xs) {
+
+    if (strcmp(xs_type, "elastic") && strcmp(xs_type, "capture") && 
+        strcmp(xs_type, "fission")) {
+        log_printf(ERROR, "Unable to set a cross-section override of type %s "
+                   "for isotope %s since only elastic, capture and fission "
+                   "cross-sections are supported", xs_type, isotope);
+        return;
+    }
+
+    if (num_energies != num_xs) {
+        log_printf(ERROR, "Unable to set a %s cross-section override for "
+                   "isotope %s with %d energies and %d cross-section values",
+                   xs_type, isotope, num_energies, num_xs);
+        return;
+    }
+
+    if (num_xs < 2) {
+        log_printf(ERROR, "Unable to set a %s cross-section override for "
+                   "isotope %s with fewer than two data points", 
+                   xs_type, isotope);
+        return;
+    }
+
+    std::vector<float> override_energies(energies, energies + num_energies);
+    std::vector<float> override_xs(xs_values, xs_values + num_xs);
+
+    _xs_overrides[getXSOverrideKey(isotope, xs_type)] = 
+                        std::make_pair(override_energies, override_xs);
+
+    log_printf(INFO, "Set a %s cross-section override with %d data points "
+               "for isotope %s", xs_type, num_xs, isotope);
+
+    return;
+}
+
+
+/**
+ * @brief Fills an array with the energies for a cross-section override.
+ * @details This function may be called from within Python as follows:
+ *
+ * @code
+ *          num_xs = getNumXSOverrideDataPoints('U-238', 'capture')
+ *          energies = retrieveXSOverrideEnergies(num_xs, 'U-238', 'capture')
+ * @endcode
+ *
+ * @param energies an array to fill with the energies (eV)
+ * @param num_xs the number of energies
+ * @param isotope the name of the isotope (ie, 'U-238')
+ * @param xs_type the cross-section type ('elastic', 'capture' or 'fission')
+ */
+void retrieveXSOverrideEnergies(float* energies, int num_xs, 
+                                const char* isotope, const char* xs_type) {
+
+    std::map< std::string, std::pair< std::vector<float>, 
+                          std::vector<float> > >::iterator iter;
+    iter = _xs_overrides.find(getXSOverrideKey(isotope, xs_type));
+
+    if (iter == _xs_overrides.end() || 
+        num_xs > int((*iter).second.first.size())) {
+        log_printf(ERROR, "Unable to retrieve %d energies for the %s "
+                   "cross-section override for isotope %s", num_xs, 
+                   xs_type, isotope);
+        return;
+    }
+
+    std::vector<float>& override_energies = (*iter).second.first;
+
+    for (int i=0; i < num_xs; i++)
+        energies[i] = override_energies[i];
+
+    return;
+}
+
+
+/**
+ * @brief Fills an array with the values for a cross-section override.
+ * @details This function may be called from within Python as follows:
+ *
+ * @code
+ *          num_xs = getNumXSOverrideDataPoints('U-238', 'capture')
+ *          xs = retrieveXSOverride(num_xs, 'U-238', 'capture')
+ * @endcode
+ *
+ * @param xs an array to fill with the cross-section values (barns)
+ * @param num_xs the number of cross-section values
+ * @param isotope the name of the isotope (ie, 'U-238')
+ * @param xs_type the cross-section type ('elastic', 'capture' or 'fission')
+ */
+void retrieveXSOverride(float* xs, int num_xs, const char* isotope, 
+                        const char* xs_type) {
+
+    std::map< std::string, std::pair< std::vector<float>, 
+                          std::vector<float> > >::iterator iter;
+    iter = _xs_overrides.find(getXSOverrideKey(isotope, xs_type));
+
+    if (iter == _xs_overrides.end() || 
+        num_xs > int((*iter).second.second.size())) {
+        log_printf(ERROR, "Unable to retrieve %d values for the %s "
+                   "cross-section override for isotope %s", num_xs, 
+                   xs_type, isotope);
+        return;
+    }
+
+    std::vector<float>& override_xs = (*iter).second.second;
+
+    for (int i=0; i < num_xs; i++)
+        xs[i] = override_xs[i];
+
+    return;
+}
+
+
+/**
+ * @brief Returns whether a cross-section override has been set for an 
+ *        isotope.
+ * @param isotope the name of the isotope (ie, 'U-238')
+ * @param xs_type the cross-section type ('elastic', 'capture' or 'fission')
+ * @return true if an override has been set; otherwise false
+ */
+bool hasXSOverride(const char* isotope, const char* xs_type) {
+    return (_xs_overrides.find(getXSOverrideKey(isotope, xs_type)) != 
+                                                         _xs_overrides.end());
+}
+
+
+/**
+ * @brief Returns the number of data points in a cross-section override.
+ * @param isotope the name of the isotope (ie, 'U-238')
+ * @param xs_type the cross-section type ('elastic', 'capture' or 'fission')
+ * @return the number of data points, or 0 if no override has been set
+ */
+int getNumXSOverrideDataPoints(const char* isotope, const char* xs_type) {
+
+    std::map< std::string, std::pair< std::vector<float>, 
+                          std::vector<float> > >::iterator iter;
+    iter = _xs_overrides.find(getXSOverrideKey(isotope, xs_type));
+
+    if (iter == _xs_overrides.end())
+        return 0;
+
+    return (*iter).second.second.size();
+}
+
+
+/**
+ * @brief Removes the cross-section override for an isotope, if any.
+ * @param isotope the name of the isotope (ie, 'U-238')
+ * @param xs_type the cross-section type ('elastic', 'capture' or 'fission')
+ */
+void clearXSOverride(const char* isotope, const char* xs_type) {
+    _xs_overrides.erase(getXSOverrideKey(isotope, xs_type));
+}
+
+
+/**
+ * @brief Removes all cross-section overrides.
+ */
+void clearXSOverrides() {
+    _xs_overrides.clear();
+}
+
+
+/**
+ * @struct xsData
+ * @brief The data parsed from a cross-section data file.
+ */
+struct xsData {
+    /** The energies (eV) */
+    std::vector<float> _energies;
+    /** The cross-section values (barns) */
+    std::vector<float> _xs_values;
+    /** The line number of the first energy which is less than the energy
+     *  before it, or 0 if the energies are sorted */
+    int _unsorted_line;
+    /** The cross-section values resampled onto the default uniform lethargy
+     *  grid, or empty if the data was not resampled */
+    std::vector<float> _rescaled_xs;
+};
+
+
+/**
+ * @var _xs_prefetches
+ * @brief Cross-section data files which are being read in the background.
+ * @details Each entry is keyed by the full path of a data file in the 
+ *          cross-section library and holds a future for the data parsed from
+ *          the file. The map itself is only accessed from the main thread.
+ */
+static std::map< std::string, std::shared_future<xsData> > _xs_prefetches;
+
+
+/**
+ * @brief Parses a buffer with the contents of a cross-section data file.
+ * @details The first line of the buffer is a header and each following line
+ *          holds an energy (eV) and a cross-section value (barns) separated
+ *          by a comma or whitespace. The values are converted in place with
+ *          strtof rather than by copying each line into a string, and blank
+ *          or malformed lines are skipped. The energies are checked to be in 
+ *          ascending order as they are parsed.
+ * @param buffer a null-terminated character array with the file contents
+ * @param length the number of characters in the buffer
+ * @param num_points the expected number of data points, or 0 if unknown
+ * @param data the data structure to fill with the parsed values
+ */
+static void parseCrossSectionBuffer(const char* buffer, size_t length, 
+                                    int num_points, xsData& data) {
+
+    const char* end = buffer + length;
+    const char* line = buffer;
+    const char* line_end;
+    char* next;
+    float energy, xs_value;
+    int line_number = 1;
+
+    /* A typical data line is 16-24 characters long */
+    if (num_points <= 0)
+        num_points = length / 16;
+
+    data._energies.reserve(num_points);
+    data._xs_values.reserve(num_points);
+    data._unsorted_line = 0;
+
+    /* Skip the header line */
+    line_end = (const char*)memchr(line, '\n', end - line);
+    line = (line_end == NULL) ? end : line_end + 1;
+
+    /* Parse over each line in the buffer */
+    while (line < end) {
+
+        line_number++;
+        line_end = (const char*)memchr(line, '\n', end - line);
+        if (line_end == NULL)
+            line_end = end;
+
+        energy = strtof(line, &next);
+
+        if (next != line && next < line_end) {
+
+            /* Skip the separator between the energy and cross-section */
+            while (next < line_end && (*next == ' ' || *next == '\t'))
+                next++;
+            if (next < line_end && *next == ',')
+                next++;
+
+            line = next;
+            xs_value = strtof(line, &next);
+
+            if (next != line && next <= line_end) {
+
+                if (data._unsorted_line == 0 && !data._energies.empty() &&
+                    energy < data._energies.back())
+                    data._unsorted_line = line_number;
+
+                data._energies.push_back(energy);
+                data._xs_values.push_back(xs_value);
+            }
+        }
+
+        line = line_end + 1;
+    }
+
+    return;
+}
+
+
+/**
+ * @brief Reads the entire contents of a file into a null-terminated buffer.
+ * @details This function may run on a background thread and therefore must 
+ *          not call log_printf.
+ * @param filename the full path of the file
+ * @param buffer the buffer to fill with the file contents
+ * @return the number of characters read, or -1 if the file does not exist
+ */
+static long readFileBuffer(const std::string& filename, 
+                           std::vector<char>& buffer) {
+
+    FILE* input_file = fopen(filename.c_str(), "rb");
+
+    if (input_file == NULL)
+        return -1;
+
+    fseek(input_file, 0, SEEK_END);
+    long length = ftell(input_file);
+    fseek(input_file, 0, SEEK_SET);
+
+    if (length < 0)
+        length = 0;
+
+    buffer.resize(length + 1);
+    length = fread(&buffer[0], 1, length, input_file);
+    buffer[length] = '\0';
+
+    fclose(input_file);
+
+    return length;
+}
+
+
+/**
+ * @brief Computes the 32-bit FNV-1a checksum of a buffer.
+ * @param buffer the character array of interest
+ * @param length the number of characters in the buffer
+ * @return the checksum
+ */
+static unsigned int computeChecksum(const char* buffer, size_t length) {
+
+    unsigned int checksum = 2166136261u;
+
+    for (size_t i=0; i < length; i++) {
+        checksum ^= (unsigned char)buffer[i];
+        checksum *= 16777619u;
+    }
+
+    return checksum;
+}
+
+
+/**
+ * @brief Reads a cross-section data file into memory and parses it.
+ * @details The file is read with a single call to fread and parsed in one 
+ *          pass. This function may run on a background thread and therefore 
+ *          must not call log_printf. If the file does not exist the arrays 
+ *          are empty.
+ * @param filename the full path of the data file
+ * @param num_points the expected number of data points, or 0 if unknown
+ * @return the data parsed from the file
+ */
+static xsData readCrossSectionFile(std::string filename, int num_points) {
+
+    xsData data;
+    std::vector<char> buffer;
+    long length = readFileBuffer(filename, buffer);
+
+    data._unsorted_line = 0;
+
+    if (length > 0)
+        parseCrossSectionBuffer(&buffer[0], length, num_points, data);
+
+    return data;
+}
+
+
+/**
+ * @brief Computes the energies of the default uniform lethargy grid.
+ * @return a vector of the energies (eV) of the grid
+ */
+static std::vector<float> computeDefaultLethargyGrid() {
+
+    float* energies = logspace<float, float>(DEFAULT_START_ENERGY, 
+                                             DEFAULT_END_ENERGY, 
+                                             DEFAULT_NUM_ENERGIES);
+    std::vector<float> grid(energies, energies + DEFAULT_NUM_ENERGIES);
+    delete [] energies;
+
+    return grid;
+}
+
+
+/**
+ * @brief Returns the energies of the default uniform lethargy grid.
+ * @details The grid is computed the first time it is needed. The
+ *          initialization of the static grid is thread safe, so it may
+ *          first be needed by a background thread.
+ * @return a reference to a vector of the energies (eV) of the grid
+ */
+static const std::vector<float>& getDefaultLethargyGrid() {
+
+    static const std::vector<float> grid = computeDefaultLethargyGrid();
+    return grid;
+}
+
+
+/**
+ * @brief Reads a cross-section data file and resamples it onto the default
+ *        uniform lethargy grid.
+ * @details Rescaling onto the grid is the costliest step of constructing an
+ *          isotope once its data files are read. A prefetched file is 
+ *          resampled on the same background thread which reads it, such 
+ *          that a newly constructed isotope only needs to copy the values.
+ *          This function runs on a background thread and therefore must not
+ *          call log_printf.
+ * @param filename the full path of the data file
+ * @param num_points the expected number of data points, or 0 if unknown
+ * @return the data parsed from the file and resampled onto the grid
+ */
+static xsData prefetchCrossSectionFile(std::string filename, int num_points) {
+
+    xsData data = readCrossSectionFile(filename, num_points);
+
+    if (data._xs_values.empty() || data._unsorted_line != 0)
+        return data;
+
+    const std::vector<float>& grid = getDefaultLethargyGrid();
+    data._rescaled_xs.resize(grid.size());
+
+    linearInterpSorted<float, const float, float>(&data._energies[0], 
+                                                  &data._xs_values[0], 
+                                                  data._xs_values.size(), 
+                                                  &grid[0], 
+                                                  &data._rescaled_xs[0], 
+                                                  grid.size());
+
+    return data;
+}
+
+
+/**
+ * @brief Reads the index for the cross-section library directory if it has
+ *        not yet been read.
+ * @details Each line of the index.txt file following the header lists an 
+ *          isotope, cross-section type, number of data points and checksum 
+ *          for one data file in the library. If the directory does not have
+ *          an index the library is probed for each data file instead.
+ * @return true if the library directory has an index; otherwise false
+ */
+static bool loadXSLibIndex() {
+
+    if (_xs_index_loaded)
+        return _xs_index_found;
 
-    /* Instantiate I/O variables */
-    std::ifstream input_file(file, std::ios::in);
+    _xs_index.clear();
+    _xs_index_loaded = true;
+    _xs_index_found = false;
+
+    std::string filename = _xs_directory + "index.txt";
+    std::ifstream input_file(filename.c_str(), std::ios::in);
     std::string buff;
-    int count = 0;
+    char isotope[64], xs_type[64];
+    xsIndexEntry entry;
+
+    if (!input_file.is_open())
+        return false;
 
-    /* get the first line of the input file */
+    /* Skip the header line */
     getline(input_file, buff);
 
-    /* Parse over each line in the file */
-    while(getline(input_file, buff)) {
-        /* Load data into the arrays for this line */
-        sscanf(buff.c_str(), "%f,%f", &energies[count], &xs_values[count]);
-        count++;
+    while (getline(input_file, buff)) {
+        if (sscanf(buff.c_str(), "%63s %63s %d %x", isotope, xs_type, 
+                   &entry._num_points, &entry._checksum) == 4)
+            _xs_index[getXSOverrideKey(isotope, xs_type)] = entry;
     }
 
-    /* Close the file and return the number of data points */
     input_file.close();
+    _xs_index_found = true;
 
-    return count;
+    log_printf(INFO, "Read the cross-section library index with %d data "
+               "files", (int)_xs_index.size());
+
+    return true;
 }
 
 
 /**
- * @brief Counts the number of lines in an cross-section input file
- * @param filename the file of interest
- * @return the number of lines in the file
+ * @brief Finds the entry in the cross-section library index for a data file.
+ * @param key the "<isotope>-<xs_type>" stem of the data file
+ * @return a pointer to the entry, or NULL if the file is not in the index
  */
-int getNumCrossSectionDataPoints(const char* filename) {
+static xsIndexEntry* findXSLibIndexEntry(const std::string& key) {
+
+    std::map<std::string, xsIndexEntry>::iterator iter = _xs_index.find(key);
+
+    if (iter == _xs_index.end())
+        return NULL;
+
+    return &(*iter).second;
+}
+
+
+/**
+ * @brief Returns whether the cross-section library directory has an index.
+ * @return true if the library has an index; otherwise false
+ */
+bool hasXSLibIndex() {
+    return loadXSLibIndex();
+}
+
+
+/**
+ * @brief Returns the number of data files listed in the cross-section
+ *        library index.
+ * @return the number of data files, or 0 if the library has no index
+ */
+int getNumXSLibIndexEntries() {
+    loadXSLibIndex();
+    return _xs_index.size();
+}
+
+
+/**
+ * @brief Builds the index for the cross-section library directory.
+ * @details Each "<isotope>-<xs_type>.txt" data file in the library directory
+ *          for an elastic, capture or fission cross-section is read to count
+ *          its data points and compute its checksum, and the results are 
+ *          written to the index.txt file in the directory. Other files, such
+ *          as resonance parameters, are not read by isotopes and are skipped.
+ *          Once a library has an index, isotopes only read the data files 
+ *          which are listed in it and never probe the directory for others. 
+ *          The index must therefore be rebuilt after data files are added to
+ *          the library, which a user may do from within Python as follows:
+ *
+ * @code
+ *          setXSLibDirectory('my-xs-lib/')
+ *          buildXSLibIndex()
+ * @endcode
+ *
+ * @return the number of data files in the index
+ */
+int buildXSLibIndex() {
+
+    DIR* directory = opendir(_xs_directory.c_str());
+    struct dirent* dir_entry;
+    std::vector<std::string> filenames;
+    std::vector<char> buffer;
+
+    if (directory == NULL) {
+        log_printf(ERROR, "Unable to build the cross-section library index "
+                   "since the directory %s does not exist", 
+                   _xs_directory.c_str());
+        return 0;
+    }
+
+    while ((dir_entry = readdir(directory)) != NULL) {
+        std::string filename = dir_entry->d_name;
+        size_t length = filename.length();
+
+        if (length > 4 && filename.compare(length-4, 4, ".txt") == 0 &&
+            filename != "index.txt")
+            filenames.push_back(filename);
+    }
+
+    closedir(directory);
+    std::sort(filenames.begin(), filenames.end());
+
+    std::string index_filename = _xs_directory + "index.txt";
+    FILE* index_file = fopen(index_filename.c_str(), "w");
+
+    if (index_file == NULL) {
+        log_printf(ERROR, "Unable to write the cross-section library index "
+                   "%s", index_filename.c_str());
+        return 0;
+    }
+
+    fprintf(index_file, "isotope xs_type num_points checksum\n");
+
+    int num_entries = 0;
+
+    for (int i=0; i < (int)filenames.size(); i++) {
+
+        /* The cross-section type follows the last dash in the file name */
+        std::string stem = filenames[i].substr(0, filenames[i].length()-4);
+        size_t dash = stem.rfind('-');
+
+        if (dash == std::string::npos || dash == 0)
+            continue;
+
+        std::string xs_type = stem.substr(dash+1);
+
+        if (xs_type != "elastic" && xs_type != "capture" && 
+            xs_type != "fission")
+            continue;
+
+        long length = readFileBuffer(_xs_directory + filenames[i], buffer);
+        xsData data;
+        parseCrossSectionBuffer(&buffer[0], length, 0, data);
+
+        fprintf(index_file, "%s %s %d %08x\n", stem.substr(0, dash).c_str(),
+                xs_type.c_str(), (int)data._xs_values.size(),
+                computeChecksum(&buffer[0], length));
+        num_entries++;
+    }
+
+    fclose(index_file);
 
-    /* Instantiate I/O variables */
-    std::ifstream input_file(filename, std::ios::in);
-    std::string line;
-    int num_xs_values = -1;
+    log_printf(NORMAL, "Built the cross-section library index %s with %d "
+               "data files", index_filename.c_str(), num_entries);
+
+    /* Read the new index the next time it is needed */
+    _xs_index_loaded = false;
+
+    return num_entries;
+}
+
+
+/**
+ * @brief Checks each data file listed in the cross-section library index
+ *        against its number of data points and checksum.
+ * @details Every data file in the index is read, so this is intended to 
+ *          verify a library after it has been copied or modified rather than
+ *          for each simulation.
+ * @return the number of data files which do not match the index
+ */
+int checkXSLibIndex() {
+
+    std::map<std::string, xsIndexEntry>::iterator iter;
+    std::vector<char> buffer;
+    int num_stale = 0;
+
+    if (!loadXSLibIndex()) {
+        log_printf(WARNING, "Unable to check the cross-section library index "
+                   "since the directory %s has no index.txt", 
+                   _xs_directory.c_str());
+        return 0;
+    }
+
+    for (iter = _xs_index.begin(); iter != _xs_index.end(); ++iter) {
+
+        long length = readFileBuffer(_xs_directory + (*iter).first + ".txt", 
+                                     buffer);
+        xsData data;
+
+        if (length >= 0)
+            parseCrossSectionBuffer(&buffer[0], length, 0, data);
+
+        if (length < 0 || 
+            (int)data._xs_values.size() != (*iter).second._num_points ||
+            computeChecksum(&buffer[0], length) != (*iter).second._checksum) {
+            log_printf(WARNING, "The cross-section library data file %s.txt "
+                       "does not match the index", (*iter).first.c_str());
+            num_stale++;
+        }
+    }
+
+    return num_stale;
+}
+
+
+/**
+ * @brief Begins reading the cross-section data files for an isotope on 
+ *        background threads.
+ * @details The elastic, capture and fission data files are each read and
+ *          resampled onto the default uniform lethargy grid concurrently 
+ *          while the calling script continues. When the isotope is later 
+ *          constructed, loadCrossSections waits for the files only if they 
+ *          are not yet finished. The isotope's thermal scattering tables are
+ *          still built when it is constructed. A user may prefetch the
+ *          isotopes for a model from within Python as follows:
+ *
+ * @code
+ *          for isotope in ['H-1', 'O-16', 'U-235', 'U-238']:
+ *              prefetchCrossSections(isotope)
+ *          h1 = Isotope('H-1')
+ * @endcode
+ *
+ * @param isotope the name of the isotope (ie, 'U-238')
+ */
+void prefetchCrossSections(const char* isotope) {
+
+    const char* xs_types[3] = {"elastic", "capture", "fission"};
+
+    log_printf(INFO, "Prefetching cross-sections for isotope %s", isotope);
+
+    for (int i=0; i < 3; i++) {
+
+        /* Overrides take precedence over the cross-section library */
+        if (hasXSOverride(isotope, xs_types[i]))
+            continue;
+
+        std::string key = getXSOverrideKey(isotope, xs_types[i]);
+        std::string filename = _xs_directory + key + ".txt";
+        int num_points = 0;
+
+        if (_xs_prefetches.find(filename) != _xs_prefetches.end())
+            continue;
+
+        /* Only read the data files which are listed in the library index */
+        if (loadXSLibIndex()) {
+            xsIndexEntry* entry = findXSLibIndexEntry(key);
+
+            if (entry == NULL)
+                continue;
+
+            num_points = entry->_num_points;
+        }
+
+        _xs_prefetches[filename] = std::async(std::launch::async, 
+                                              prefetchCrossSectionFile, 
+                                              filename, num_points).share();
+    }
+
+    return;
+}
+
+
+/**
+ * @brief Returns the number of cross-section data files which have been 
+ *        prefetched but not yet loaded by an isotope.
+ * @return the number of prefetched data files
+ */
+int getNumPrefetchedCrossSections() {
+    return _xs_prefetches.size();
+}
+
+
+/**
+ * @brief Discards all prefetched cross-section data, waiting for any data 
+ *        files which are still being read.
+ */
+void clearPrefetchedCrossSections() {
 
-    /* Loop over each line and update counter */
-    while(getline(input_file, line))
-        num_xs_values++;
+    std::map< std::string, std::shared_future<xsData> >::iterator iter;
+
+    for (iter = _xs_prefetches.begin(); iter != _xs_prefetches.end(); ++iter)
+        (*iter).second.wait();
+
+    _xs_prefetches.clear();
+}
+
+
+/**
+ * @brief Loads the cross-section data for an isotope into newly allocated
+ *        arrays.
+ * @details This is the single entry point used by isotopes to find their
+ *          cross-section data. If an override has been set for the isotope
+ *          and cross-section type it is used; otherwise the data is parsed
+ *          from the appropriately named file in the cross-section library,
+ *          or taken from the background read if the file was prefetched.
+ *          If the library has an index, files which are not listed in it 
+ *          (ie, fission data for non-fissionable isotopes) are known not to 
+ *          exist without probing the library directory. A caller which 
+ *          rescales the data onto the default uniform lethargy grid may 
+ *          instead be given the prefetched data already resampled onto the
+ *          grid. The arrays are allocated by this function and ownership 
+ *          passes to the caller.
+ * @param isotope the name of the isotope (ie, 'U-238')
+ * @param xs_type the cross-section type ('elastic', 'capture' or 'fission')
+ * @param energies a pointer to the array to allocate for the energies (eV)
+ * @param xs_values a pointer to the array to allocate for the cross-sections
+ * @param rescaled a pointer to set to true if the data is on the default 
+ *        uniform lethargy grid, or NULL if the data is not to be resampled
+ * @return the number of data points, or 0 if no data was found
+ */
+int loadCrossSections(const char* isotope, const char* xs_type, 
+                      float** energies, float** xs_values, bool* rescaled) {
+
+    std::string key = getXSOverrideKey(isotope, xs_type);
+    int num_xs;
+
+    if (rescaled != NULL)
+        *rescaled = false;
+
+    /* Use the in-memory override if one has been set */
+    std::map< std::string, std::pair< std::vector<float>, 
+                          std::vector<float> > >::iterator iter;
+    iter = _xs_overrides.find(key);
+
+    if (iter != _xs_overrides.end()) {
+
+        log_printf(INFO, "Loading the %s cross-section override for "
+                   "isotope %s", xs_type, isotope);
+
+        num_xs = (*iter).second.second.size();
+        *energies = new float[num_xs];
+        *xs_values = new float[num_xs];
+
+        for (int i=0; i < num_xs; i++) {
+            (*energies)[i] = (*iter).second.first[i];
+            (*xs_values)[i] = (*iter).second.second[i];
+        }
+
+        return num_xs;
+    }
+
+    /* Otherwise parse the data file from the cross-section library, or use
+     * the prefetched data if the file is being read in the background */
+    std::string filename = _xs_directory + key + ".txt";
+    xsIndexEntry* entry = NULL;
+    xsData data;
+
+    /* If the library has an index, only data files listed in it exist */
+    if (loadXSLibIndex()) {
+        entry = findXSLibIndexEntry(key);
+
+        if (entry == NULL)
+            return 0;
+    }
+
+    std::map< std::string, std::shared_future<xsData> >::iterator prefetch;
+    prefetch = _xs_prefetches.find(filename);
+
+    if (prefetch != _xs_prefetches.end()) {
+        data = (*prefetch).second.get();
+        _xs_prefetches.erase(prefetch);
+    }
+    else
+        data = readCrossSectionFile(filename, 
+                                    (entry == NULL) ? 0 : entry->_num_points);
+
+    num_xs = data._xs_values.size();
+
+    if (entry != NULL && num_xs != entry->_num_points)
+        log_printf(WARNING, "The number of data points in %s.txt does not "
+                   "match the cross-section library index. The index may be "
+                   "rebuilt with buildXSLibIndex()", key.c_str());
+
+    if (num_xs == 0)
+        return 0;
+
+    if (data._unsorted_line != 0) {
+        log_printf(ERROR, "Unable to load %s.txt for isotope %s since the "
+                   "energy on line %d is less than the energy before it", 
+                   key.c_str(), isotope, data._unsorted_line);
+        return 0;
+    }
+
+    log_printf(INFO, "Loading %s.txt for isotope %s", key.c_str(), isotope);
+
+    /* Use the values resampled in the background if the caller would 
+     * rescale the data onto the default grid */
+    if (rescaled != NULL && !data._rescaled_xs.empty()) {
+        const std::vector<float>& grid = getDefaultLethargyGrid();
+
+        num_xs = grid.size();
+        *energies = new float[num_xs];
+        *xs_values = new float[num_xs];
+        std::copy(grid.begin(), grid.end(), *energies);
+        std::copy(data._rescaled_xs.begin(), data._rescaled_xs.end(), 
+                  *xs_values);
+        *rescaled = true;
+
+        return num_xs;
+    }
+
+    *energies = new float[num_xs];
+    *xs_values = new float[num_xs];
+    std::copy(data._energies.begin(), data._energies.end(), *energies);
+    std::copy(data._xs_values.begin(), data._xs_values.end(), *xs_values);
+
+    return num_xs;
+}
+
+
+/**
+ * @brief Converts a number in the ENDF-6 format without an "E" before the 
+ *        exponent (ie, "6.673491+0") into a double.
+ * @param string the character array for the number
+ * @return the value of the number
+ */
+static double parseENDFNumber(const char* string) {
+
+    char* exponent;
+    double mantissa = strtod(string, &exponent);
+
+    if (*exponent == '+' || *exponent == '-')
+        mantissa *= pow(10.0, strtol(exponent, NULL, 10));
+
+    return mantissa;
+}
+
+
+/**
+ * @brief Loads the single-level Breit-Wigner resonance parameters for an 
+ *        isotope into newly allocated arrays.
+ * @details The parameters are parsed from the "<isotope>-RP.txt" file in the
+ *          cross-section library. The first line of the file holds the 
+ *          potential scattering cross-section \f$ 4\pi a_p^2 \f$ (barns) 
+ *          and each line following the two header lines holds the resonance
+ *          energy, J, \f$ \Gamma_n \f$, \f$ \Gamma_{\gamma} \f$ and the 
+ *          fission widths for a resonance. Only resonances at positive 
+ *          energies are loaded. The arrays are allocated by this function and 
+ *          ownership passes to the caller.
+ * @param isotope the name of the isotope (ie, 'U-238')
+ * @param resonance_energies a pointer to the array to allocate for the 
+ *        resonance energies (eV)
+ * @param gamma_n a pointer to the array to allocate for the neutron widths (eV)
+ * @param gamma_g a pointer to the array to allocate for the capture widths (eV)
+ * @param sigma_p a pointer to the potential scattering cross-section (barns)
+ * @return the number of resonances, or 0 if no data was found
+ */
+int loadResonanceParameters(const char* isotope, float** resonance_energies,
+                            float** gamma_n, float** gamma_g, float* sigma_p) {
+
+    std::string filename = _xs_directory + isotope + "-RP.txt";
+    std::ifstream input_file(filename.c_str(), std::ios::in);
+    std::string buff;
+    std::vector<float> energies, neutron_widths, capture_widths;
+    char E0[32], J[32], GN[32], GG[32];
+
+    if (!input_file.is_open())
+        return 0;
+
+    log_printf(INFO, "Loading %s-RP.txt for isotope %s", isotope, isotope);
+
+    /* The first line holds the potential scattering cross-section */
+    getline(input_file, buff);
+    if (sscanf(buff.c_str(), "%*s %f", sigma_p) != 1)
+        log_printf(ERROR, "Unable to parse the potential scattering "
+                   "cross-section from %s-RP.txt", isotope);
+
+    /* Skip the two header lines for the table of resonances */
+    getline(input_file, buff);
+    getline(input_file, buff);
+
+    /* Parse over each resonance */
+    while(getline(input_file, buff)) {
+
+        if (sscanf(buff.c_str(), "%31s %31s %31s %31s", E0, J, GN, GG) != 4)
+            continue;
+
+        if (parseENDFNumber(E0) <= 0.0)
+            continue;
+
+        energies.push_back(parseENDFNumber(E0));
+        neutron_widths.push_back(parseENDFNumber(GN));
+        capture_widths.push_back(parseENDFNumber(GG));
+    }
 
-    /* Close the file and return the number of lines */
     input_file.close();
-    return num_xs_values;
+
+    int num_resonances = energies.size();
+    *resonance_energies = new float[num_resonances];
+    *gamma_n = new float[num_resonances];
+    *gamma_g = new float[num_resonances];
+
+    for (int i=0; i < num_resonances; i++) {
+        (*resonance_energies)[i] = energies[i];
+        (*gamma_n)[i] = neutron_widths[i];
+        (*gamma_g)[i] = capture_widths[i];
+    }
+
+    return num_resonances;
+}
+
+
+/**
+ * @brief Parses an input file of cross-section data
+ * @details Loads the energy values (as eV) and the cross-section values 
+ *          (barns) into two float arrays which must be large enough to hold
+ *          the number of data points given by getNumCrossSectionDataPoints.
+ * @param file the filename for the data
+ * @param energies a pointer to a float array for the energies (eV)
+ * @param xs_values a pointer to a float array fo the xs values (barns)
+ * @return the number of data points
+ */
+int parseCrossSections(const char* file, float* energies, float* xs_values) {
+
+    xsData data = readCrossSectionFile(file, 0);
+
+    std::copy(data._energies.begin(), data._energies.end(), energies);
+    std::copy(data._xs_values.begin(), data._xs_values.end(), xs_values);
+
+    return data._xs_values.size();
+}
+
+
+/**
+ * @brief Counts the number of data points in an cross-section input file
+ * @param filename the file of interest
+ * @return the number of data points in the file
+ */
+int getNumCrossSectionDataPoints(const char* filename) {
+    return readCrossSectionFile(filename, 0)._xs_values.size();
 }
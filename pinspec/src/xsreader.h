@@ -16,15 +16,62 @@
 #include <fstream>
 #include <sstream>
 #include <stdlib.h>
+#include <math.h>
 #include <string>
+#include <map>
+#include <vector>
+#include <sys/stat.h>
+#include <dirent.h>
+#include <future>
+#include <algorithm>
 #include "log.h"
+#include "arraycreator.h"
+#include "interpolate.h"
 #endif
 
+/** The lowest energy (eV) of the uniform lethargy grid which isotopes are
+ *  rescaled onto when they are constructed */
+#define DEFAULT_START_ENERGY 1E-5
+
+/** The highest energy (eV) of the default uniform lethargy grid */
+#define DEFAULT_END_ENERGY 2E7
+
+/** The number of energies in the default uniform lethargy grid */
+#define DEFAULT_NUM_ENERGIES 100000
+
 void setXSLibDirectory(const char* directory);
 const char* getXSLibDirectory();
 int restoreXSLibrary();
 int parseCrossSections(const char* file, float* energies, float* xs_values);
 int getNumCrossSectionDataPoints(const char* filename);
 
+/* IMPORTANT: The following function prototypes must not be changed
+ * without changing Geometry.i to allow for the data arrays to be 
+ * transformed into numpy arrays */
+void setXSOverride(const char* isotope, const char* xs_type, 
+                   double* energies, int num_energies, 
+                   double* xs_values, int num_xs);
+void retrieveXSOverrideEnergies(float* energies, int num_xs, 
+                                const char* isotope, const char* xs_type);
+void retrieveXSOverride(float* xs, int num_xs, const char* isotope, 
+                        const char* xs_type);
+
+bool hasXSOverride(const char* isotope, const char* xs_type);
+int getNumXSOverrideDataPoints(const char* isotope, const char* xs_type);
+void clearXSOverride(const char* isotope, const char* xs_type);
+void clearXSOverrides();
+int loadCrossSections(const char* isotope, const char* xs_type, 
+                      float** energies, float** xs_values, 
+                      bool* rescaled=NULL);
+void prefetchCrossSections(const char* isotope);
+int getNumPrefetchedCrossSections();
+void clearPrefetchedCrossSections();
+int buildXSLibIndex();
+bool hasXSLibIndex();
+int getNumXSLibIndexEntries();
+int checkXSLibIndex();
+int loadResonanceParameters(const char* isotope, float** resonance_energies,
+                            float** gamma_n, float** gamma_g, float* sigma_p);
+
 
 #endif /* XSREADER_H_ */
@@ -44,8 +44,10 @@ h1.setCaptureXS(h1_capture_energies, h1_capture_xs)
 # Zero out the scatter, fission xs for U-238
 energy = numpy.array([1E-7, 2e7])	        # energy bounds
 xs = numpy.array([0.0])				# one group xs
+u238.beginXSUpdate()
 u238.setMultigroupElasticXS(energy, xs)
 u238.setMultigroupFissionXS(energy, xs)
+u238.commitXSUpdate()
 
 py_printf('INFO', 'Plotting microscopic cross-sections...')
 plotter.plotMicroXS(h1, ['capture', 'elastic', 'fission'])
@@ -157,7 +157,10 @@ lethargy_flux = TallyFactory.createTally(h1_material, FLUX)
 lethargy_flux.generateBinEdges(1E-2, 1E7, 5000, LOGARITHMIC)
 
 neutron = createNewNeutron()
-fissioner = Fissioner()
+
+# Sample the source energies from the Watt fission spectrum
+source = Source()
+source_energies = source.sampleEnergies(num_neutrons)
 
 py_printf('INFO', 'Simulating H-1 flux for %d generations...', \
                                                         num_generations)
@@ -166,8 +169,7 @@ py_printf('INFO', '# neutrons = %d\t\t# generations = %d',
 
 for i in range(num_neutrons):	
 
-    # Sample a fission energy from the Watt fission spectrum 
-    neutron._energy = fissioner.emitNeutroneV()
+    neutron._energy = source_energies[i]
 
     for j in range(num_generations):
         h1_material.collideNeutron(neutron)
@@ -88,6 +88,9 @@ rho_moderator = (vol_coolant / vol_moderator) * rho_coolant + \
 ###############################################################################
 
 py_printf('INFO', 'Initializing isotopes...')
+for isotope in ['H-1', 'O-16', 'U-235', 'U-238', 'Zr-90']:
+    prefetchCrossSections(isotope)
+
 h1 = Isotope('H-1')
 o16 = Isotope('O-16')
 u235 = Isotope('U-235')
@@ -31,18 +31,25 @@ pinspec = Extension('_pinspec',
                    sources=['pinspec/Geometry.i',
                             'pinspec/src/log.cpp', 
                             'pinspec/src/xsreader.cpp', 
+                            'pinspec/src/Multipole.cpp', 
+                            'pinspec/src/CompactXS.cpp', 
                             'pinspec/src/Isotope.cpp', 
                             'pinspec/src/Material.cpp', 
                             'pinspec/src/Neutron.cpp',
                             'pinspec/src/Tally.cpp',
                             'pinspec/src/TallyFactory.cpp',
 			    'pinspec/src/TallyBank.cpp',
+                            'pinspec/src/Source.cpp',
                             'pinspec/src/Fissioner.cpp',
                             'pinspec/src/Region.cpp',
                             'pinspec/src/Timer.cpp',
                             'pinspec/src/Surface.cpp', 
+                            'pinspec/src/Lattice.cpp', 
+                            'pinspec/src/PinCell.cpp', 
+                            'pinspec/src/CompiledGeometry.cpp', 
+                            'pinspec/src/TrackRecorder.cpp', 
                             'pinspec/src/Geometry.cpp'],
-                   extra_compile_args=['-O3', '-fopenmp',
+                   extra_compile_args=['-O3', '-fopenmp', '-std=c++11',
                                     '-march=native', '-ffast-math', '-g'],
                    extra_link_args=['-lstdc++', '-fopenmp', '-lgomp'],
                    language='c++',
@@ -58,7 +65,7 @@ dist = setup(  name        = 'PINSPEC',
         version     = '0.1',
         ext_modules = [pinspec],
         packages = ['pinspec'],
-		package_data = {'pinspec': ['xs-lib/*.txt', 'xs-lib/BackupXS/*.txt']},
+		package_data = {'pinspec': ['xs-lib/*.txt']},
         )
 
 # Rerun the build_py to setup links for C++ extension modules created by SWIG
@@ -6,6 +6,7 @@ import pinspec.process as process
 from pinspec.log import *
 import unittest
 import os
+import tempfile
 
 
 # 1) Unit test important C++ and python functions
@@ -28,6 +29,45 @@ class TestXSReader(unittest.TestCase):
         ret = restoreXSLibrary()
         self.assertEqual(ret, 0)
 
+
+    # check that cross-section overrides are used in place of the library
+    def testXSOverride(self):
+        py_printf('UNITTEST', 'Testing xsreader setXSOverride')
+        energies = numpy.array([1E-5, 1., 2E7])
+        xs = numpy.array([10., 5., 1.])
+        setXSOverride('H-1', 'capture', energies, xs)
+        self.assertTrue(hasXSOverride('H-1', 'capture'))
+        self.assertEqual(getNumXSOverrideDataPoints('H-1', 'capture'), 3)
+        h1 = Isotope('H-1')
+        self.assertAlmostEqual(h1.getCaptureXS(1.), 5., places=3)
+        restoreXSLibrary()
+        self.assertFalse(hasXSOverride('H-1', 'capture'))
+
+
+    # check that prefetched cross-sections are consumed by new isotopes
+    def testPrefetchCrossSections(self):
+        py_printf('UNITTEST', 'Testing xsreader prefetchCrossSections')
+        clearPrefetchedCrossSections()
+        prefetchCrossSections('H-1')
+        # H-1 has no fission data in the library index
+        self.assertEqual(getNumPrefetchedCrossSections(), 2)
+        h1 = Isotope('H-1')
+        self.assertEqual(getNumPrefetchedCrossSections(), 0)
+        self.assertEqual(h1.getTotalXS(1.), Isotope('H-1').getTotalXS(1.))
+
+        # Data resampled in the background should match the isotope's own
+        # rescaling onto the uniform lethargy grid
+        prefetchCrossSections('U-238')
+        u238_prefetched = Isotope('U-238')
+        u238 = Isotope('U-238')
+        for energy in [1E-3, 0.0253, 6.67, 20.9, 1E3, 1E6]:
+            self.assertEqual(u238_prefetched.getCaptureXS(energy), 
+                             u238.getCaptureXS(energy))
+            self.assertEqual(u238_prefetched.getElasticXS(energy), 
+                             u238.getElasticXS(energy))
+            self.assertEqual(u238_prefetched.getFissionXS(energy), 
+                             u238.getFissionXS(energy))
+
     
     # check to make sure all xs files return at least 1 xs data point
     def testGetNumCrossSectionDataPoints(self):
@@ -42,6 +82,24 @@ class TestXSReader(unittest.TestCase):
                 self.assertGreater(num_points, 0)
 
 
+    # check that the library index matches the installed data files
+    def testXSLibIndex(self):
+        py_printf('UNITTEST', 'Testing xsreader checkXSLibIndex')
+        self.assertTrue(hasXSLibIndex())
+        self.assertGreater(getNumXSLibIndexEntries(), 0)
+        self.assertEqual(checkXSLibIndex(), 0)
+
+
+    # check that blank lines are skipped and whitespace separators parsed
+    def testParseCrossSections(self):
+        py_printf('UNITTEST', 'Testing xsreader parseCrossSections')
+        xs_file = tempfile.NamedTemporaryFile(suffix='.txt', delete=False)
+        xs_file.write('header\n1.0,2.0\n\n10.0   3.0\r\n100.0,4.0')
+        xs_file.close()
+        self.assertEqual(getNumCrossSectionDataPoints(xs_file.name), 3)
+        os.remove(xs_file.name)
+
+
 class TestIsotope(unittest.TestCase):
     
     
@@ -90,6 +148,52 @@ class TestIsotope(unittest.TestCase):
         self.assertEqual(o16.getTemperature(), 500)
 
 
+    # Test interpolation between temperature tables
+    def testTemperatureTables(self):
+        py_printf('UNITTEST', 'Testing Isotope addTemperatureTable')
+        u238 = Isotope('U-238')
+        energies = numpy.array([1E-7, 2E7])
+        u238.setCaptureXS(energies, numpy.array([10., 10.]))
+        u238.addTemperatureTable(300.)
+        u238.setCaptureXS(energies, numpy.array([20., 20.]))
+        u238.addTemperatureTable(1200.)
+        self.assertEqual(u238.getNumTemperatureTables(), 2)
+        self.assertAlmostEqual(u238.getCaptureXS(1., 750.), 15., places=3)
+        u238.setTemperatureInterpolation(SQRT_TEMPERATURE)
+        self.assertAlmostEqual(u238.getCaptureXS(1., 300.), 10., places=3)
+        self.assertAlmostEqual(u238.getCaptureXS(1., 2000.), 20., places=3)
+
+
+    # Test the windowed multipole resolved resonance representation
+    def testMultipole(self):
+        py_printf('UNITTEST', 'Testing Isotope useMultipole')
+        u238 = Isotope('U-238')
+        u238.useMultipole(num_windows=500, energy_min=1., energy_max=1000.)
+        self.assertTrue(u238.usesMultipole())
+        self.assertEqual(u238.getMultipole().getNumWindows(), 500)
+        # Doppler broadening lowers the peak of the 6.67 eV resonance
+        self.assertTrue(u238.getCaptureXS(6.67, 1200.) <
+                        u238.getCaptureXS(6.67, 300.))
+        # Energies outside of the multipole range use the tabulated data
+        self.assertEqual(u238.getCaptureXS(1E4, 300.), u238.getCaptureXS(1E4))
+        u238.neglectMultipole()
+        self.assertFalse(u238.usesMultipole())
+
+
+    # Test the reduced precision cross-section storage
+    def testXSPrecision(self):
+        py_printf('UNITTEST', 'Testing Isotope setXSPrecision')
+        u235 = Isotope('U-235')
+        total_xs = u235.getTotalXS(1.)
+        u235.setXSPrecision(BFLOAT16_XS)
+        self.assertEqual(u235.getXSPrecision(), BFLOAT16_XS)
+        self.assertLess(u235.getXSPrecisionError('total'), 2.**-8)
+        self.assertAlmostEqual(u235.getTotalXS(1.) / total_xs, 1., places=2)
+        u235.setXSPrecision(FLOAT32_XS)
+        self.assertEqual(u235.getXSPrecisionError('total'), 0.)
+        self.assertEqual(u235.getTotalXS(1.), total_xs)
+
+
     # Test Isotope constructor to see if A is set to the correct value
     def testA(self):
         py_printf('UNITTEST', 'Testing Isotope set A')
@@ -135,6 +239,19 @@ class TestIsotope(unittest.TestCase):
         self.assertLessEqual(abs((u235.getTotalXS(1.0e3) + u235.getFissionXS(1.0e3) + u235.getTransportXS(1.0e3)) / (u235.getElasticXS(1.0e3) + u235.getAbsorptionXS(1.0e3) + u235.getFissionXS(1.0e3) + + u235.getTransportXS(1.0e3)) - 1), .001)
 
 
+    # Test Isotope evaluateXS function for an array of energies
+    def testEvaluateXS(self):
+        py_printf('UNITTEST', 'Testing Isotope evaluateXS')
+        u235 = Isotope('U-235')
+        energies = numpy.array([1E-2, 1., 1E3, 1E6])
+        xs = u235.evaluateXS(energies, energies.size, 'fission')
+        self.assertEqual(len(xs), energies.size)
+        for i in range(energies.size):
+            self.assertEqual(xs[i], u235.getFissionXS(energies[i]))
+        xs = u235.evaluateXS(energies, energies.size, 'fision')
+        self.assertTrue(numpy.isnan(xs).all())
+
+
     # Test Isotope get xs functions with Index input
     def testGetXSbyIndex(self):
         py_printf('UNITTEST', 'Testing Isotope get xs functions by Index')
@@ -221,6 +338,35 @@ class TestIsotope(unittest.TestCase):
             self.fail('Unable to set capture XS')
 
 
+    # Test Isotope beginXSUpdate and commitXSUpdate functions
+    def testXSUpdate(self):
+        py_printf('UNITTEST', 'Testing Isotope beginXSUpdate')
+        u235 = Isotope('U-235')
+        energies = numpy.array([1E-7, 2E7])
+        u235.beginXSUpdate()
+        self.assertTrue(u235.isUpdatingXS())
+        u235.setMultigroupElasticXS(energies, numpy.array([3.]))
+        u235.setMultigroupCaptureXS(energies, numpy.array([2.]))
+        u235.setMultigroupFissionXS(energies, numpy.array([1.]))
+        u235.commitXSUpdate()
+        self.assertFalse(u235.isUpdatingXS())
+        self.assertAlmostEqual(u235.getTotalXS(1.), 6., places=4)
+
+
+    # Test that the absorption and total xs are rebuilt after a setter
+    def testDerivedXS(self):
+        py_printf('UNITTEST', 'Testing Isotope absorption and total xs')
+        u238 = Isotope('U-238')
+        u238.setMultigroupElasticXS(numpy.array([1E-7, 2E7]),
+                                    numpy.array([2.]))
+        for energy in [0.0253, 6.67, 1E4]:
+            absorb = u238.getCaptureXS(energy) + u238.getFissionXS(energy)
+            self.assertAlmostEqual(u238.getAbsorptionXS(energy), absorb,
+                                   places=3)
+            self.assertAlmostEqual(u238.getTotalXS(energy), absorb + 2.,
+                                   places=3)
+
+
     # Test Isotope neglectThermalScattering function
     def testNeglectThermalScattering(self):
         py_printf('UNITTEST', 'Testing Isotope neglectThermalScattering')
@@ -596,6 +742,37 @@ class TestMaterial(unittest.TestCase):
         self.assertGreater(mod.getTransportMacroXS(1.0), 0.0)
 
 
+    # Test Material evaluateMacroXS function for an array of energies
+    def testEvaluateMacroXS(self):
+        py_printf('UNITTEST', 'Testing Material evaluateMacroXS')
+        mod = Material('mod')
+        mod.setDensity(5., 'g/cc')
+        mod.addIsotope(self.h1, 1.0)
+        mod.addIsotope(self.o16, 0.5)
+        energies = numpy.logspace(-2, 6, 100)
+        xs = mod.evaluateMacroXS(energies, energies.size, 'total')
+        micro_xs = mod.evaluateMicroXS(energies, energies.size, 'total')
+        self.assertAlmostEqual(xs[50] / mod.getTotalMacroXS(energies[50]), 1.)
+        self.assertAlmostEqual(micro_xs[50] / mod.getTotalMicroXS(energies[50]), 1.)
+
+
+    # Test the tabulated macroscopic cross-sections
+    def testXSTables(self):
+        py_printf('UNITTEST', 'Testing Material buildXSTables')
+        mod = Material('mod')
+        mod.setDensity(5., 'g/cc')
+        mod.addIsotope(self.h1, 1.0)
+        sigma_t = mod.getTotalMacroXS(1.0)
+        mod.buildXSTables()
+        self.assertTrue(mod.hasXSTables())
+        self.assertAlmostEqual(mod.getTotalMacroXS(1.0) / sigma_t, 1., places=4)
+        mod.addIsotope(self.o16, 0.5)
+        self.assertFalse(mod.hasXSTables())
+        mod.buildXSTables()
+        self.h1.setXSPrecision(FLOAT32_XS)
+        self.assertFalse(mod.hasXSTables())
+
+
     # Test Material addIsotope function
     def testAddIsotope(self):
         py_printf('UNITTEST', 'Testing Material addIsotope')
@@ -858,6 +1035,16 @@ class TestRegion(unittest.TestCase):
         self.assertGreater(region_mix.getTransportMacroXS(100), 0.0)
 
 
+    # Test Region evaluateMacroXS function for an array of energies
+    def testEvaluateMacroXS(self):
+        py_printf('UNITTEST', 'Testing Region evaluateMacroXS')
+        region_mix = InfiniteMediumRegion('mix')
+        region_mix.setMaterial(self.mix)
+        energies = numpy.logspace(-2, 6, 100)
+        xs = region_mix.evaluateMacroXS(energies, energies.size, 'capture')
+        self.assertAlmostEqual(xs[50] / region_mix.getCaptureMacroXS(energies[50]), 1.)
+
+
     # Test Region collideNeutron function
     def testCollideNeutron(self):
         py_printf('UNITTEST', 'Testing Region collideNeutron')
@@ -872,6 +1059,91 @@ class TestRegion(unittest.TestCase):
             self.fail('Unable to collide neutron')
 
 
+    # Test BoundedRegion findNextRegion function
+    def testFindNextRegion(self):
+        py_printf('UNITTEST', 'Testing BoundedRegion findNextRegion')
+        pin = ZCylinder('pin')
+        pin.setRadius(0.45)
+        region_fuel = BoundedFuelRegion('fuel')
+        region_fuel.addBoundingSurface(-1, pin)
+        region_mod = BoundedModeratorRegion('moderator')
+        region_mod.addBoundingSurface(1, pin)
+        region_fuel.clearNeighbors()
+        region_fuel.addNeighbor(pin, region_mod)
+        neutron = createNewNeutron()
+        neutron._surface = pin
+        neutron._y = 0.0
+        neutron._z = 0.0
+
+        neutron._x = 0.2
+        self.assertEqual(region_fuel.findNextRegion(neutron).getName(), 'fuel')
+        neutron._x = 0.5
+        self.assertEqual(region_fuel.findNextRegion(neutron).getName(),
+                         'moderator')
+
+
+    # Test BoundedRegion addNeighbor function
+    def testAddNeighbor(self):
+        py_printf('UNITTEST', 'Testing BoundedRegion addNeighbor')
+        middle = XPlane('middle')
+        middle.setX(0.0)
+        bottom = YPlane('bottom')
+        bottom.setY(-1.0)
+        top = YPlane('top')
+        top.setY(1.0)
+        region_left = BoundedModeratorRegion('left')
+        region_left.addBoundingSurface(-1, middle)
+        region_left.addBoundingSurface(1, bottom)
+        region_left.addBoundingSurface(-1, top)
+        region_right = BoundedModeratorRegion('right')
+        region_right.addBoundingSurface(1, middle)
+        region_right.addBoundingSurface(1, bottom)
+        region_right.addBoundingSurface(-1, top)
+        region_above = BoundedModeratorRegion('above')
+        region_above.addBoundingSurface(1, middle)
+        region_above.addBoundingSurface(1, top)
+        region_left.clearNeighbors()
+        region_left.addNeighbor(middle, region_right)
+        region_left.addNeighbor(middle, region_above)
+
+        # The region above the top plane cannot be entered across the middle
+        self.assertEqual(region_left.getNumNeighbors(middle), 1)
+        self.assertEqual(region_left.getNumNeighbors(top), 0)
+
+
+    # Test BoundedRegion groupBoundingSurfaces function
+    def testGroupBoundingSurfaces(self):
+        py_printf('UNITTEST', 'Testing BoundedRegion groupBoundingSurfaces')
+        pin = ZCylinder('pin')
+        pin.setRadius(0.5)
+        right = XPlane('right')
+        right.setX(1.0)
+        top = YPlane('top')
+        top.setY(1.0)
+        region_mod = BoundedModeratorRegion('moderator')
+        region_mod.addBoundingSurface(-1, top)
+        region_mod.addBoundingSurface(1, pin)
+        region_mod.addBoundingSurface(-1, right)
+        neutron = createNewNeutron()
+        neutron._x = 0.7
+        neutron._y = 0.0
+        neutron._u = -1.0
+        neutron._v = 0.0
+
+        distance = region_mod.computeParametrizedDistance(neutron)
+        region_mod.groupBoundingSurfaces()
+        self.assertTrue(region_mod.areSurfacesGrouped())
+        self.assertAlmostEqual(region_mod.computeParametrizedDistance(neutron),
+                               distance, places=5)
+        self.assertAlmostEqual(distance, 0.2, places=5)
+
+        neutron._u = 0.6
+        neutron._v = 0.8
+        self.assertAlmostEqual(region_mod.computeParametrizedDistance(neutron),
+                               0.5, places=5)
+        self.assertEqual(neutron._surface.getSurfaceName(), 'right')
+
+
     # Test Region contains function
 #    def testContains(self):       
 #        py_printf('UNITTEST', 'Testing Region contains')
@@ -891,6 +1163,50 @@ class TestRegion(unittest.TestCase):
 
 
 
+class TestSource(unittest.TestCase):
+
+    # Test Source sampling of the default Watt spectrum
+    def testWattSpectrum(self):
+        py_printf('UNITTEST', 'Testing Source Watt spectrum')
+        source = Source()
+        self.assertEqual(source.getSourceType(), WATT_SOURCE)
+        energies = source.sampleEnergies(100000)
+        self.assertAlmostEqual(numpy.mean(energies) / 1.981E6, 1., places=1)
+
+
+    # Test Source sampling of a tabulated spectrum
+    def testTabulatedSpectrum(self):
+        py_printf('UNITTEST', 'Testing Source setTabulatedSpectrum')
+        source = Source()
+        source.setTabulatedSpectrum(numpy.array([1., 2., 3., 4.]), \
+                                    numpy.array([1., 0., 2.]))
+        self.assertEqual(source.getNumBins(), 3)
+        energies = source.sampleEnergies(10000)
+        self.assertFalse(numpy.any((energies > 2.) & (energies < 3.)))
+        self.assertAlmostEqual(numpy.mean(energies < 2.), 1./3., places=1)
+
+
+    # Test Source monoenergetic and per-isotope chi spectra
+    def testMonoenergeticAndChiSpectrum(self):
+        py_printf('UNITTEST', 'Testing Source setMonoenergetic and setChiSpectrum')
+        source = Source()
+        source.setMonoenergetic(2E6)
+        self.assertEqual(source.sampleEnergy(), 2E6)
+        source.setChiSpectrum(Isotope('U-235'))
+        self.assertEqual(source.getSourceType(), WATT_SOURCE)
+        self.assertAlmostEqual(source.getWattA(), 0.988, places=5)
+
+
+    # Test Geometry getSource function
+    def testGeometrySource(self):
+        py_printf('UNITTEST', 'Testing Geometry getSource')
+        geometry = Geometry(INFINITE_HOMOGENEOUS)
+        geometry.getSource().setMonoenergetic(1E6)
+        self.assertEqual(geometry.getSource().getSourceType(), \
+                                                        MONOENERGETIC_SOURCE)
+
+
+
 class TestGeometry(unittest.TestCase):
 
     def setUp(self):
@@ -921,6 +1237,58 @@ class TestGeometry(unittest.TestCase):
         # Define region
         self.region_mix = InfiniteMediumRegion('mix')
         self.region_mix.setMaterial(self.mix)
+
+
+    # Build the fuel and moderator regions of a 1.26 cm pin cell with a 
+    # 0.45 cm fuel pin and the given boundary type on the cell edges
+    def makePinCellRegions(self, boundary_type, fuel_material=None,
+                           moderator_material=None):
+        pin = ZCylinder('pin')
+        pin.setRadius(0.45)
+        pin.setBoundaryType(INTERFACE)
+        left = XPlane('left')
+        left.setX(-0.63)
+        left.setBoundaryType(boundary_type)
+        right = XPlane('right')
+        right.setX(0.63)
+        right.setBoundaryType(boundary_type)
+        bottom = YPlane('bottom')
+        bottom.setY(-0.63)
+        bottom.setBoundaryType(boundary_type)
+        top = YPlane('top')
+        top.setY(0.63)
+        top.setBoundaryType(boundary_type)
+
+        region_fuel = BoundedFuelRegion('fuel')
+        region_fuel.addBoundingSurface(-1, pin)
+        region_mod = BoundedModeratorRegion('moderator')
+        region_mod.addBoundingSurface(1, pin)
+        region_mod.addBoundingSurface(1, left)
+        region_mod.addBoundingSurface(-1, right)
+        region_mod.addBoundingSurface(1, bottom)
+        region_mod.addBoundingSurface(-1, top)
+
+        if fuel_material is not None:
+            region_fuel.setMaterial(fuel_material)
+        if moderator_material is not None:
+            region_mod.setMaterial(moderator_material)
+
+        return region_fuel, region_mod
+
+
+    # Run a simulation of a geometry and return the mean and standard 
+    # deviation of the number of absorptions per neutron in a region
+    def computeAbsorption(self, geometry, region):
+        tally = TallyFactory.createTally(region, ABSORPTION_RATE)
+        tally.generateBinEdges(1E-7, 2E7, 1, LOGARITHMIC)
+        TallyBank.registerTally(tally)
+        geometry.runMonteCarloSimulation()
+        TallyBank.clearTallies()
+
+        # The tally is normalized by the volume of the region
+        volume = region.getVolume()
+        return (process.getTallyBatchMu(tally)[0] * volume, 
+                process.getTallyBatchStdDev(tally)[0] * volume)
     
     
     # Test Geometry getNumNeutronsPerBatch function
@@ -1007,6 +1375,245 @@ class TestGeometry(unittest.TestCase):
             self.fail('Could not add Region')
 
 
+    # Test Geometry source site sampling in a heterogeneous pin cell
+    def testInitializeSourceNeutron(self):
+        py_printf('UNITTEST', 'Testing Geometry initializeSourceNeutron')
+        pin = ZCylinder('pin')
+        pin.setRadius(0.1)
+        region_fuel = BoundedFuelRegion('fuel')
+        region_fuel.setMaterial(self.mix)
+        region_fuel.addBoundingSurface(-1, pin)
+        geometry = Geometry(HETEROGENEOUS)
+        geometry.addRegion(region_fuel)
+        neutron = createNewNeutron()
+
+        for i in range(100):
+            geometry.initializeSourceNeutron(neutron)
+            self.assertLessEqual(neutron._x**2 + neutron._y**2, 0.01)
+            self.assertAlmostEqual(neutron._u**2 + neutron._v**2 + 
+                                   neutron._w**2, 1.0, places=5)
+
+
+    # Test Geometry findContainingRegion function
+    def testFindContainingRegion(self):
+        py_printf('UNITTEST', 'Testing Geometry findContainingRegion')
+        region_fuel, region_mod = self.makePinCellRegions(REFLECTIVE, self.mix, self.mix)
+        geometry = Geometry(HETEROGENEOUS)
+        geometry.addRegion(region_fuel)
+        geometry.addRegion(region_mod)
+
+        # The regions are found from the grid after a simulation
+        geometry.setNumBatches(1)
+        geometry.setNeutronsPerBatch(100)
+        geometry.runMonteCarloSimulation()
+
+        self.assertEqual('fuel',
+                         geometry.findContainingRegion(0.1, 0.2, 0.).getName())
+        self.assertEqual('moderator',
+                         geometry.findContainingRegion(0.6, 0.6, 0.).getName())
+        self.assertIsNone(geometry.findContainingRegion(0.7, 0., 0.))
+
+
+    # Test Geometry setDeltaTracking function
+    def testDeltaTracking(self):
+        py_printf('UNITTEST', 'Testing Geometry setDeltaTracking')
+        fuel = Material('fuel')
+        fuel.setDensity(10.2, 'g/cc')
+        fuel.addIsotope(self.u235, 0.03)
+        fuel.addIsotope(self.u238, 0.97)
+        fuel.addIsotope(self.o16, 2.0)
+        water = Material('water')
+        water.setDensity(1.0, 'g/cc')
+        water.addIsotope(self.h1, 2.0)
+        water.addIsotope(self.o16, 1.0)
+        region_fuel, region_mod = self.makePinCellRegions(REFLECTIVE, fuel, water)
+        geometry = Geometry(HETEROGENEOUS)
+        geometry.addRegion(region_fuel)
+        geometry.addRegion(region_mod)
+        geometry.setNumBatches(10)
+        geometry.setNeutronsPerBatch(2000)
+
+        tallies = [TallyFactory.createTally(region_fuel, FLUX),
+                   TallyFactory.createTally(region_mod, FLUX),
+                   TallyFactory.createTally(region_fuel, ABSORPTION_RATE),
+                   TallyFactory.createTally(region_mod, ABSORPTION_RATE)]
+        for tally in tallies:
+            tally.generateBinEdges(1E-7, 2E7, 1, LOGARITHMIC)
+            TallyBank.registerTally(tally)
+
+        # The tallies of surface and delta tracking should agree to within
+        # their statistical uncertainties
+        results = []
+        for delta_tracking in [False, True]:
+            geometry.setDeltaTracking(delta_tracking)
+            geometry.runMonteCarloSimulation()
+            results.append([(process.getTallyBatchMu(tally)[0], 
+                             process.getTallyBatchStdDev(tally)[0]) 
+                            for tally in tallies])
+
+        TallyBank.clearTallies()
+
+        for (surface_mu, surface_std), (delta_mu, delta_std) in zip(*results):
+            self.assertGreater(surface_mu, 0.)
+            self.assertLess(abs(surface_mu - delta_mu), 
+                            4. * numpy.sqrt(surface_std**2 + delta_std**2))
+
+
+    # Test Geometry setLattice function
+    def testSetLattice(self):
+        py_printf('UNITTEST', 'Testing Geometry setLattice')
+        region_fuel, region_mod = self.makePinCellRegions(INTERFACE, self.mix, self.mix)
+        universe = Universe('pin cell')
+        universe.addRegion(region_fuel)
+        universe.addRegion(region_mod)
+        lattice = Lattice(2, 2, 1.26, 1.26)
+        lattice.fillUniverse(universe)
+        geometry = Geometry(HETEROGENEOUS)
+        geometry.setLattice(lattice)
+        self.assertEqual(lattice.getCell(0.5, -0.5), 1)
+        self.assertEqual(lattice.getCell(1.5, 0.0), -1)
+        self.assertEqual(geometry.findContainingRegion(0.63, 0.63, 0.0).getName(), 'fuel')
+        self.assertEqual(geometry.findContainingRegion(0.1, 0.1, 0.0).getName(), 'moderator')
+
+        # A reflected lattice of identical cells should have the same number
+        # of absorptions per neutron in the fuel as one reflected cell
+        lattice.setBoundaryType(REFLECTIVE)
+        geometry.setNumBatches(10)
+        geometry.setNeutronsPerBatch(1000)
+        lattice_mu, lattice_std = self.computeAbsorption(geometry, region_fuel)
+        region_fuel, region_mod = self.makePinCellRegions(REFLECTIVE, self.mix, self.mix)
+        geometry = Geometry(HETEROGENEOUS)
+        geometry.addRegion(region_fuel)
+        geometry.addRegion(region_mod)
+        geometry.setNumBatches(10)
+        geometry.setNeutronsPerBatch(1000)
+        cell_mu, cell_std = self.computeAbsorption(geometry, region_fuel)
+        self.assertGreater(cell_mu, 0.)
+        self.assertLess(abs(lattice_mu - cell_mu), 
+                        4. * numpy.sqrt(lattice_std**2 + cell_std**2))
+
+
+    # Test PinCell region lookup
+    def testPinCell(self):
+        py_printf('UNITTEST', 'Testing PinCell findRegion')
+        pin = PinCell(0.39, 0.40, 0.46, 1.26, 4, 'pin')
+        pin.setFuelMaterial(self.mix)
+        pin.setGapMaterial(self.mix)
+        pin.setCladdingMaterial(self.mix)
+        pin.setModeratorMaterial(self.mix)
+        self.assertEqual(pin.getNumFuelRings(), 4)
+        self.assertEqual(pin.getNumRegions(), 7)
+        self.assertAlmostEqual(pin.getFuelRing(0).getVolume(), pin.getFuelRing(3).getVolume(), 5)
+        lattice = Lattice(1, 1, 1.26, 1.26)
+        lattice.fillUniverse(pin)
+        geometry = Geometry(HETEROGENEOUS)
+        geometry.setLattice(lattice)
+        self.assertEqual(geometry.findContainingRegion(0.3, 0.0, 0.0).getName(), 'pin fuel ring 2')
+        self.assertEqual(geometry.findContainingRegion(0.0, 0.43, 0.0).getName(), 'pin cladding')
+        self.assertEqual(geometry.findContainingRegion(0.6, 0.6, 0.0).getName(), 'pin moderator')
+
+        # A pin cell with one fuel ring and no gap or cladding should have 
+        # the same number of absorptions per neutron in the fuel as the 
+        # same pin built from bounded regions
+        water = Material('water')
+        water.setDensity(1.0, 'g/cc')
+        water.addIsotope(self.h1, 2.0)
+        water.addIsotope(self.o16, 1.0)
+        pin = PinCell(0.45, 0.45, 0.45, 1.26, 1, 'flat pin')
+        pin.setFuelMaterial(self.mix)
+        pin.setModeratorMaterial(water)
+        self.assertEqual(pin.getNumRegions(), 2)
+        lattice = Lattice(1, 1, 1.26, 1.26)
+        lattice.fillUniverse(pin)
+        geometry = Geometry(HETEROGENEOUS)
+        geometry.setLattice(lattice)
+        geometry.setNumBatches(10)
+        geometry.setNeutronsPerBatch(1000)
+        pin_mu, pin_std = self.computeAbsorption(geometry, pin.getFuelRing(0))
+        region_fuel, region_mod = self.makePinCellRegions(REFLECTIVE, self.mix, water)
+        geometry = Geometry(HETEROGENEOUS)
+        geometry.addRegion(region_fuel)
+        geometry.addRegion(region_mod)
+        geometry.setNumBatches(10)
+        geometry.setNeutronsPerBatch(1000)
+        cell_mu, cell_std = self.computeAbsorption(geometry, region_fuel)
+        self.assertGreater(cell_mu, 0.)
+        self.assertLess(abs(pin_mu - cell_mu), 
+                        4. * numpy.sqrt(pin_std**2 + cell_std**2))
+
+
+    # Test Geometry compilation
+    def testCompiledGeometry(self):
+        py_printf('UNITTEST', 'Testing Geometry getCompiledGeometry')
+        region_fuel, region_mod = self.makePinCellRegions(REFLECTIVE, self.mix, self.mix)
+        geometry = Geometry(HETEROGENEOUS)
+        geometry.addRegion(region_fuel)
+        geometry.addRegion(region_mod)
+        geometry.setNumBatches(1)
+        geometry.setNeutronsPerBatch(100)
+        self.assertEqual(geometry.getCompiledGeometry(), None)
+        geometry.runMonteCarloSimulation()
+        compiled = geometry.getCompiledGeometry()
+        self.assertEqual(compiled.getNumRegions(), 2)
+        self.assertEqual(compiled.getNumSurfaces(), 5)
+        self.assertEqual(compiled.getNumHalfspaces(), 6)
+        index = compiled.getRegionIndex(region_mod)
+        self.assertEqual(compiled.getRegion(index).getName(), 'moderator')
+
+
+    # Test Geometry computeVolumes function
+    def testComputeVolumes(self):
+        py_printf('UNITTEST', 'Testing Geometry computeVolumes')
+        region_fuel, region_mod = self.makePinCellRegions(REFLECTIVE)
+        region_mod.setVolume(1.26**2 - numpy.pi * 0.45**2)
+        geometry = Geometry(HETEROGENEOUS)
+        geometry.addRegion(region_fuel)
+        geometry.addRegion(region_mod)
+        geometry.computeVolumes(100000)
+        self.assertTrue(region_fuel.isVolumeSet())
+        self.assertTrue(region_fuel.getVolumeUncertainty() > 0.)
+        self.assertAlmostEqual(region_fuel.getVolume(), numpy.pi * 0.45**2, 1)
+        self.assertEqual(region_mod.getVolumeUncertainty(), 0.)
+        self.assertAlmostEqual(geometry.getVolume(), 1.26**2, 1)
+
+
+    # Test Geometry rasterizeSlice function
+    def testRasterizeSlice(self):
+        py_printf('UNITTEST', 'Testing Geometry rasterizeSlice')
+        region_fuel, region_mod = self.makePinCellRegions(REFLECTIVE, self.mix)
+        geometry = Geometry(HETEROGENEOUS)
+        geometry.addRegion(region_fuel)
+        geometry.addRegion(region_mod)
+        uids = geometry.rasterizeSlice(3*4, 'XY', 0., -0.6, 0.6, -0.6, 0.9, 3)
+        uids = uids.reshape((4, 3))
+        self.assertEqual(uids[0][0], region_mod.getUid())
+        self.assertEqual(uids[1][1], region_fuel.getUid())
+        self.assertEqual(uids[3][1], 0)
+        uids = geometry.rasterizeSlice(3*4, 'XY', 0., -0.6, 0.6, -0.6, 0.9, 3,
+                                       True).reshape((4, 3))
+        self.assertEqual(uids[0][0], 0)
+        self.assertEqual(uids[1][1], self.mix.getUid())
+
+
+    # Test Geometry recordTracks function
+    def testRecordTracks(self):
+        py_printf('UNITTEST', 'Testing Geometry recordTracks')
+        region_fuel, region_mod = self.makePinCellRegions(REFLECTIVE, self.mix, self.mix)
+        geometry = Geometry(HETEROGENEOUS)
+        geometry.addRegion(region_fuel)
+        geometry.addRegion(region_mod)
+        recorder = TrackRecorder(100000)
+        geometry.recordTracks(recorder, 10)
+        num_points = recorder.getNumPoints()
+        events = recorder.retrieveEvents(num_points)
+        tracks = recorder.retrieveTracks(num_points)
+        self.assertEqual(recorder.getNumTracks(), 10)
+        self.assertEqual(list(events).count(SOURCE), 10)
+        self.assertEqual(events[0], SOURCE)
+        self.assertEqual(tracks[num_points-1], 9)
+        self.assertTrue(events[num_points-1] in [ABSORPTION, LEAKAGE])
+
+
     # Test Geometry runMonteCarloSimulation function
     def testRunMonteCarloSimulation(self):
         py_printf('UNITTEST', 'Testing Geometry runMonteCarloSimulation')